@@ -0,0 +1,25 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef BENCH_COMMON_HPP
+#define BENCH_COMMON_HPP
+
+#include <cstdint>
+#include <ctime>
+
+namespace bench {
+
+//! \brief Get the current monotonic time in nanoseconds
+static inline uint64_t now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+} // namespace bench
+
+#endif // BENCH_COMMON_HPP
@@ -0,0 +1,421 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef BENCH_OPERATIONS_HPP
+#define BENCH_OPERATIONS_HPP
+
+#include <mpi.h>
+
+//! The C and Fortran interfaces of the intercepted operations, in the same
+//! order as the definitions of the Sonar MPI library. Each operation has its
+//! C name and the lowercase and uppercase names of its Fortran interface
+#define FOREACH_OPERATION_MPI3(F)                                              \
+    F(MPI_Type_free, mpi_type_free, MPI_TYPE_FREE)                             \
+    F(MPI_Request_free, mpi_request_free, MPI_REQUEST_FREE)                    \
+    F(MPI_Comm_free, mpi_comm_free, MPI_COMM_FREE)                             \
+    F(MPI_Pcontrol, mpi_pcontrol, MPI_PCONTROL)                                \
+    F(MPI_Wait, mpi_wait, MPI_WAIT)                                            \
+    F(MPI_Waitall, mpi_waitall, MPI_WAITALL)                                   \
+    F(MPI_Waitany, mpi_waitany, MPI_WAITANY)                                   \
+    F(MPI_Waitsome, mpi_waitsome, MPI_WAITSOME)                                \
+    F(MPI_Test, mpi_test, MPI_TEST)                                            \
+    F(MPI_Testall, mpi_testall, MPI_TESTALL)                                   \
+    F(MPI_Testany, mpi_testany, MPI_TESTANY)                                   \
+    F(MPI_Testsome, mpi_testsome, MPI_TESTSOME)                                \
+    F(MPI_Improbe, mpi_improbe, MPI_IMPROBE)                                   \
+    F(MPI_Iprobe, mpi_iprobe, MPI_IPROBE)                                      \
+    F(MPI_Mprobe, mpi_mprobe, MPI_MPROBE)                                      \
+    F(MPI_Probe, mpi_probe, MPI_PROBE)                                         \
+    F(MPI_Bsend, mpi_bsend, MPI_BSEND)                                         \
+    F(MPI_Mrecv, mpi_mrecv, MPI_MRECV)                                         \
+    F(MPI_Recv, mpi_recv, MPI_RECV)                                            \
+    F(MPI_Rsend, mpi_rsend, MPI_RSEND)                                         \
+    F(MPI_Send, mpi_send, MPI_SEND)                                            \
+    F(MPI_Sendrecv, mpi_sendrecv, MPI_SENDRECV)                                \
+    F(MPI_Sendrecv_replace, mpi_sendrecv_replace, MPI_SENDRECV_REPLACE)        \
+    F(MPI_Ssend, mpi_ssend, MPI_SSEND)                                         \
+    F(MPI_Allgather, mpi_allgather, MPI_ALLGATHER)                             \
+    F(MPI_Allgatherv, mpi_allgatherv, MPI_ALLGATHERV)                          \
+    F(MPI_Allreduce, mpi_allreduce, MPI_ALLREDUCE)                             \
+    F(MPI_Alltoall, mpi_alltoall, MPI_ALLTOALL)                                \
+    F(MPI_Alltoallv, mpi_alltoallv, MPI_ALLTOALLV)                             \
+    F(MPI_Alltoallw, mpi_alltoallw, MPI_ALLTOALLW)                             \
+    F(MPI_Barrier, mpi_barrier, MPI_BARRIER)                                   \
+    F(MPI_Bcast, mpi_bcast, MPI_BCAST)                                         \
+    F(MPI_Gather, mpi_gather, MPI_GATHER)                                      \
+    F(MPI_Gatherv, mpi_gatherv, MPI_GATHERV)                                   \
+    F(MPI_Reduce, mpi_reduce, MPI_REDUCE)                                      \
+    F(MPI_Reduce_scatter, mpi_reduce_scatter, MPI_REDUCE_SCATTER)              \
+    F(MPI_Reduce_scatter_block, mpi_reduce_scatter_block,                      \
+      MPI_REDUCE_SCATTER_BLOCK)                                                \
+    F(MPI_Scatter, mpi_scatter, MPI_SCATTER)                                   \
+    F(MPI_Scatterv, mpi_scatterv, MPI_SCATTERV)                                \
+    F(MPI_Scan, mpi_scan, MPI_SCAN)                                            \
+    F(MPI_Exscan, mpi_exscan, MPI_EXSCAN)                                      \
+    F(MPI_Ibsend, mpi_ibsend, MPI_IBSEND)                                      \
+    F(MPI_Imrecv, mpi_imrecv, MPI_IMRECV)                                      \
+    F(MPI_Irecv, mpi_irecv, MPI_IRECV)                                         \
+    F(MPI_Irsend, mpi_irsend, MPI_IRSEND)                                      \
+    F(MPI_Isend, mpi_isend, MPI_ISEND)                                         \
+    F(MPI_Issend, mpi_issend, MPI_ISSEND)                                      \
+    F(MPI_Iallgather, mpi_iallgather, MPI_IALLGATHER)                          \
+    F(MPI_Iallgatherv, mpi_iallgatherv, MPI_IALLGATHERV)                       \
+    F(MPI_Iallreduce, mpi_iallreduce, MPI_IALLREDUCE)                          \
+    F(MPI_Ialltoall, mpi_ialltoall, MPI_IALLTOALL)                             \
+    F(MPI_Ialltoallv, mpi_ialltoallv, MPI_IALLTOALLV)                          \
+    F(MPI_Ialltoallw, mpi_ialltoallw, MPI_IALLTOALLW)                          \
+    F(MPI_Ibarrier, mpi_ibarrier, MPI_IBARRIER)                                \
+    F(MPI_Ibcast, mpi_ibcast, MPI_IBCAST)                                      \
+    F(MPI_Igather, mpi_igather, MPI_IGATHER)                                   \
+    F(MPI_Igatherv, mpi_igatherv, MPI_IGATHERV)                                \
+    F(MPI_Ireduce, mpi_ireduce, MPI_IREDUCE)                                   \
+    F(MPI_Ireduce_scatter, mpi_ireduce_scatter, MPI_IREDUCE_SCATTER)           \
+    F(MPI_Ireduce_scatter_block, mpi_ireduce_scatter_block,                    \
+      MPI_IREDUCE_SCATTER_BLOCK)                                               \
+    F(MPI_Iscatter, mpi_iscatter, MPI_ISCATTER)                                \
+    F(MPI_Iscatterv, mpi_iscatterv, MPI_ISCATTERV)                             \
+    F(MPI_Iscan, mpi_iscan, MPI_ISCAN)                                         \
+    F(MPI_Iexscan, mpi_iexscan, MPI_IEXSCAN)                                   \
+    F(MPI_Bsend_init, mpi_bsend_init, MPI_BSEND_INIT)                          \
+    F(MPI_Recv_init, mpi_recv_init, MPI_RECV_INIT)                             \
+    F(MPI_Rsend_init, mpi_rsend_init, MPI_RSEND_INIT)                          \
+    F(MPI_Send_init, mpi_send_init, MPI_SEND_INIT)                             \
+    F(MPI_Ssend_init, mpi_ssend_init, MPI_SSEND_INIT)                          \
+    F(MPI_Start, mpi_start, MPI_START)                                         \
+    F(MPI_Startall, mpi_startall, MPI_STARTALL)                                \
+    F(MPI_Win_allocate, mpi_win_allocate, MPI_WIN_ALLOCATE)                    \
+    F(MPI_Win_allocate_shared, mpi_win_allocate_shared,                        \
+      MPI_WIN_ALLOCATE_SHARED)                                                 \
+    F(MPI_Win_create, mpi_win_create, MPI_WIN_CREATE)                          \
+    F(MPI_Win_create_dynamic, mpi_win_create_dynamic, MPI_WIN_CREATE_DYNAMIC)  \
+    F(MPI_Win_free, mpi_win_free, MPI_WIN_FREE)                                \
+    F(MPI_Accumulate, mpi_accumulate, MPI_ACCUMULATE)                          \
+    F(MPI_Compare_and_swap, mpi_compare_and_swap, MPI_COMPARE_AND_SWAP)        \
+    F(MPI_Fetch_and_op, mpi_fetch_and_op, MPI_FETCH_AND_OP)                    \
+    F(MPI_Get, mpi_get, MPI_GET)                                               \
+    F(MPI_Get_accumulate, mpi_get_accumulate, MPI_GET_ACCUMULATE)              \
+    F(MPI_Put, mpi_put, MPI_PUT)                                               \
+    F(MPI_Raccumulate, mpi_raccumulate, MPI_RACCUMULATE)                       \
+    F(MPI_Rget, mpi_rget, MPI_RGET)                                            \
+    F(MPI_Rget_accumulate, mpi_rget_accumulate, MPI_RGET_ACCUMULATE)           \
+    F(MPI_Rput, mpi_rput, MPI_RPUT)                                            \
+    F(MPI_Win_fence, mpi_win_fence, MPI_WIN_FENCE)                             \
+    F(MPI_Win_post, mpi_win_post, MPI_WIN_POST)                                \
+    F(MPI_Win_start, mpi_win_start, MPI_WIN_START)                             \
+    F(MPI_Win_complete, mpi_win_complete, MPI_WIN_COMPLETE)                    \
+    F(MPI_Win_wait, mpi_win_wait, MPI_WIN_WAIT)                                \
+    F(MPI_Win_test, mpi_win_test, MPI_WIN_TEST)                                \
+    F(MPI_Win_lock, mpi_win_lock, MPI_WIN_LOCK)                                \
+    F(MPI_Win_unlock, mpi_win_unlock, MPI_WIN_UNLOCK)                          \
+    F(MPI_Win_lock_all, mpi_win_lock_all, MPI_WIN_LOCK_ALL)                    \
+    F(MPI_Win_unlock_all, mpi_win_unlock_all, MPI_WIN_UNLOCK_ALL)              \
+    F(MPI_Win_flush, mpi_win_flush, MPI_WIN_FLUSH)                             \
+    F(MPI_Win_flush_all, mpi_win_flush_all, MPI_WIN_FLUSH_ALL)                 \
+    F(MPI_Win_flush_local, mpi_win_flush_local, MPI_WIN_FLUSH_LOCAL)           \
+    F(MPI_Win_flush_local_all, mpi_win_flush_local_all,                        \
+      MPI_WIN_FLUSH_LOCAL_ALL)                                                 \
+    F(MPI_Win_sync, mpi_win_sync, MPI_WIN_SYNC)                                \
+    F(MPI_File_open, mpi_file_open, MPI_FILE_OPEN)                             \
+    F(MPI_File_close, mpi_file_close, MPI_FILE_CLOSE)                          \
+    F(MPI_File_set_view, mpi_file_set_view, MPI_FILE_SET_VIEW)                 \
+    F(MPI_File_sync, mpi_file_sync, MPI_FILE_SYNC)                             \
+    F(MPI_File_read, mpi_file_read, MPI_FILE_READ)                             \
+    F(MPI_File_read_at, mpi_file_read_at, MPI_FILE_READ_AT)                    \
+    F(MPI_File_read_shared, mpi_file_read_shared, MPI_FILE_READ_SHARED)        \
+    F(MPI_File_write, mpi_file_write, MPI_FILE_WRITE)                          \
+    F(MPI_File_write_at, mpi_file_write_at, MPI_FILE_WRITE_AT)                 \
+    F(MPI_File_write_shared, mpi_file_write_shared, MPI_FILE_WRITE_SHARED)     \
+    F(MPI_File_read_all, mpi_file_read_all, MPI_FILE_READ_ALL)                 \
+    F(MPI_File_read_at_all, mpi_file_read_at_all, MPI_FILE_READ_AT_ALL)        \
+    F(MPI_File_read_ordered, mpi_file_read_ordered, MPI_FILE_READ_ORDERED)     \
+    F(MPI_File_write_all, mpi_file_write_all, MPI_FILE_WRITE_ALL)              \
+    F(MPI_File_write_at_all, mpi_file_write_at_all, MPI_FILE_WRITE_AT_ALL)     \
+    F(MPI_File_write_ordered, mpi_file_write_ordered, MPI_FILE_WRITE_ORDERED)  \
+    F(MPI_File_iread, mpi_file_iread, MPI_FILE_IREAD)                          \
+    F(MPI_File_iread_at, mpi_file_iread_at, MPI_FILE_IREAD_AT)                 \
+    F(MPI_File_iread_shared, mpi_file_iread_shared, MPI_FILE_IREAD_SHARED)     \
+    F(MPI_File_iwrite, mpi_file_iwrite, MPI_FILE_IWRITE)                       \
+    F(MPI_File_iwrite_at, mpi_file_iwrite_at, MPI_FILE_IWRITE_AT)              \
+    F(MPI_File_iwrite_shared, mpi_file_iwrite_shared, MPI_FILE_IWRITE_SHARED)  \
+    F(MPI_File_read_all_begin, mpi_file_read_all_begin,                        \
+      MPI_FILE_READ_ALL_BEGIN)                                                 \
+    F(MPI_File_read_all_end, mpi_file_read_all_end, MPI_FILE_READ_ALL_END)     \
+    F(MPI_File_read_at_all_begin, mpi_file_read_at_all_begin,                  \
+      MPI_FILE_READ_AT_ALL_BEGIN)                                              \
+    F(MPI_File_read_at_all_end, mpi_file_read_at_all_end,                      \
+      MPI_FILE_READ_AT_ALL_END)                                                \
+    F(MPI_File_read_ordered_begin, mpi_file_read_ordered_begin,                \
+      MPI_FILE_READ_ORDERED_BEGIN)                                             \
+    F(MPI_File_read_ordered_end, mpi_file_read_ordered_end,                    \
+      MPI_FILE_READ_ORDERED_END)                                               \
+    F(MPI_File_write_all_begin, mpi_file_write_all_begin,                      \
+      MPI_FILE_WRITE_ALL_BEGIN)                                                \
+    F(MPI_File_write_all_end, mpi_file_write_all_end, MPI_FILE_WRITE_ALL_END)  \
+    F(MPI_File_write_at_all_begin, mpi_file_write_at_all_begin,                \
+      MPI_FILE_WRITE_AT_ALL_BEGIN)                                             \
+    F(MPI_File_write_at_all_end, mpi_file_write_at_all_end,                    \
+      MPI_FILE_WRITE_AT_ALL_END)                                               \
+    F(MPI_File_write_ordered_begin, mpi_file_write_ordered_begin,              \
+      MPI_FILE_WRITE_ORDERED_BEGIN)                                            \
+    F(MPI_File_write_ordered_end, mpi_file_write_ordered_end,                  \
+      MPI_FILE_WRITE_ORDERED_END)                                              \
+    F(MPI_Neighbor_allgather, mpi_neighbor_allgather, MPI_NEIGHBOR_ALLGATHER)  \
+    F(MPI_Neighbor_allgatherv, mpi_neighbor_allgatherv,                        \
+      MPI_NEIGHBOR_ALLGATHERV)                                                 \
+    F(MPI_Neighbor_alltoall, mpi_neighbor_alltoall, MPI_NEIGHBOR_ALLTOALL)     \
+    F(MPI_Neighbor_alltoallv, mpi_neighbor_alltoallv, MPI_NEIGHBOR_ALLTOALLV)  \
+    F(MPI_Neighbor_alltoallw, mpi_neighbor_alltoallw, MPI_NEIGHBOR_ALLTOALLW)  \
+    F(MPI_Ineighbor_allgather, mpi_ineighbor_allgather,                        \
+      MPI_INEIGHBOR_ALLGATHER)                                                 \
+    F(MPI_Ineighbor_allgatherv, mpi_ineighbor_allgatherv,                      \
+      MPI_INEIGHBOR_ALLGATHERV)                                                \
+    F(MPI_Ineighbor_alltoall, mpi_ineighbor_alltoall, MPI_INEIGHBOR_ALLTOALL)  \
+    F(MPI_Ineighbor_alltoallv, mpi_ineighbor_alltoallv,                        \
+      MPI_INEIGHBOR_ALLTOALLV)                                                 \
+    F(MPI_Ineighbor_alltoallw, mpi_ineighbor_alltoallw,                        \
+      MPI_INEIGHBOR_ALLTOALLW)                                                 \
+    F(MPI_Cart_create, mpi_cart_create, MPI_CART_CREATE)                       \
+    F(MPI_Graph_create, mpi_graph_create, MPI_GRAPH_CREATE)                    \
+    F(MPI_Dist_graph_create, mpi_dist_graph_create, MPI_DIST_GRAPH_CREATE)     \
+    F(MPI_Dist_graph_create_adjacent, mpi_dist_graph_create_adjacent,          \
+      MPI_DIST_GRAPH_CREATE_ADJACENT)                                          \
+    F(MPI_Comm_dup, mpi_comm_dup, MPI_COMM_DUP)                                \
+    F(MPI_Comm_split, mpi_comm_split, MPI_COMM_SPLIT)                          \
+    F(MPI_Comm_split_type, mpi_comm_split_type, MPI_COMM_SPLIT_TYPE)           \
+    F(MPI_Comm_create, mpi_comm_create, MPI_COMM_CREATE)                       \
+    F(MPI_Comm_create_group, mpi_comm_create_group, MPI_COMM_CREATE_GROUP)     \
+    F(MPI_Intercomm_create, mpi_intercomm_create, MPI_INTERCOMM_CREATE)
+
+//! The version MPI 3.1 introduces the non-blocking collective file accesses
+#define FOREACH_OPERATION_MPI31(F)                                             \
+    F(MPI_File_iread_all, mpi_file_iread_all, MPI_FILE_IREAD_ALL)              \
+    F(MPI_File_iread_at_all, mpi_file_iread_at_all, MPI_FILE_IREAD_AT_ALL)     \
+    F(MPI_File_iwrite_all, mpi_file_iwrite_all, MPI_FILE_IWRITE_ALL)           \
+    F(MPI_File_iwrite_at_all, mpi_file_iwrite_at_all, MPI_FILE_IWRITE_AT_ALL)
+
+//! The version MPI 4.0 introduces the non-blocking sendrecv primitives, the
+//! partitioned primitives and the persistent collectives
+#define FOREACH_OPERATION_MPI4(F)                                              \
+    F(MPI_Isendrecv, mpi_isendrecv, MPI_ISENDRECV)                             \
+    F(MPI_Isendrecv_replace, mpi_isendrecv_replace, MPI_ISENDRECV_REPLACE)     \
+    F(MPI_Parrived, mpi_parrived, MPI_PARRIVED)                                \
+    F(MPI_Precv_init, mpi_precv_init, MPI_PRECV_INIT)                          \
+    F(MPI_Pready, mpi_pready, MPI_PREADY)                                      \
+    F(MPI_Pready_list, mpi_pready_list, MPI_PREADY_LIST)                       \
+    F(MPI_Pready_range, mpi_pready_range, MPI_PREADY_RANGE)                    \
+    F(MPI_Psend_init, mpi_psend_init, MPI_PSEND_INIT)                          \
+    F(MPI_Allgather_init, mpi_allgather_init, MPI_ALLGATHER_INIT)              \
+    F(MPI_Allgatherv_init, mpi_allgatherv_init, MPI_ALLGATHERV_INIT)           \
+    F(MPI_Allreduce_init, mpi_allreduce_init, MPI_ALLREDUCE_INIT)              \
+    F(MPI_Alltoall_init, mpi_alltoall_init, MPI_ALLTOALL_INIT)                 \
+    F(MPI_Alltoallv_init, mpi_alltoallv_init, MPI_ALLTOALLV_INIT)              \
+    F(MPI_Alltoallw_init, mpi_alltoallw_init, MPI_ALLTOALLW_INIT)              \
+    F(MPI_Barrier_init, mpi_barrier_init, MPI_BARRIER_INIT)                    \
+    F(MPI_Bcast_init, mpi_bcast_init, MPI_BCAST_INIT)                          \
+    F(MPI_Gather_init, mpi_gather_init, MPI_GATHER_INIT)                       \
+    F(MPI_Gatherv_init, mpi_gatherv_init, MPI_GATHERV_INIT)                    \
+    F(MPI_Reduce_init, mpi_reduce_init, MPI_REDUCE_INIT)                       \
+    F(MPI_Reduce_scatter_init, mpi_reduce_scatter_init,                        \
+      MPI_REDUCE_SCATTER_INIT)                                                 \
+    F(MPI_Reduce_scatter_block_init, mpi_reduce_scatter_block_init,            \
+      MPI_REDUCE_SCATTER_BLOCK_INIT)                                           \
+    F(MPI_Scatter_init, mpi_scatter_init, MPI_SCATTER_INIT)                    \
+    F(MPI_Scatterv_init, mpi_scatterv_init, MPI_SCATTERV_INIT)                 \
+    F(MPI_Scan_init, mpi_scan_init, MPI_SCAN_INIT)                             \
+    F(MPI_Exscan_init, mpi_exscan_init, MPI_EXSCAN_INIT)                       \
+    F(MPI_Neighbor_allgather_init, mpi_neighbor_allgather_init,                \
+      MPI_NEIGHBOR_ALLGATHER_INIT)                                             \
+    F(MPI_Neighbor_allgatherv_init, mpi_neighbor_allgatherv_init,              \
+      MPI_NEIGHBOR_ALLGATHERV_INIT)                                            \
+    F(MPI_Neighbor_alltoall_init, mpi_neighbor_alltoall_init,                  \
+      MPI_NEIGHBOR_ALLTOALL_INIT)                                              \
+    F(MPI_Neighbor_alltoallv_init, mpi_neighbor_alltoallv_init,                \
+      MPI_NEIGHBOR_ALLTOALLV_INIT)                                             \
+    F(MPI_Neighbor_alltoallw_init, mpi_neighbor_alltoallw_init,                \
+      MPI_NEIGHBOR_ALLTOALLW_INIT)
+
+//! The version MPI 4.0 also introduces the large count variants, whose only
+//! Fortran interfaces are the mpi_f08 bindings
+#define FOREACH_LARGE_OPERATION_MPI4(F)                                        \
+    F(MPI_Bsend_c, mpi_bsend_c)                                                \
+    F(MPI_Mrecv_c, mpi_mrecv_c)                                                \
+    F(MPI_Recv_c, mpi_recv_c)                                                  \
+    F(MPI_Rsend_c, mpi_rsend_c)                                                \
+    F(MPI_Send_c, mpi_send_c)                                                  \
+    F(MPI_Sendrecv_c, mpi_sendrecv_c)                                          \
+    F(MPI_Sendrecv_replace_c, mpi_sendrecv_replace_c)                          \
+    F(MPI_Ssend_c, mpi_ssend_c)                                                \
+    F(MPI_Bsend_init_c, mpi_bsend_init_c)                                      \
+    F(MPI_Recv_init_c, mpi_recv_init_c)                                        \
+    F(MPI_Rsend_init_c, mpi_rsend_init_c)                                      \
+    F(MPI_Send_init_c, mpi_send_init_c)                                        \
+    F(MPI_Ssend_init_c, mpi_ssend_init_c)                                      \
+    F(MPI_Allgather_c, mpi_allgather_c)                                        \
+    F(MPI_Allgatherv_c, mpi_allgatherv_c)                                      \
+    F(MPI_Allreduce_c, mpi_allreduce_c)                                        \
+    F(MPI_Alltoall_c, mpi_alltoall_c)                                          \
+    F(MPI_Alltoallv_c, mpi_alltoallv_c)                                        \
+    F(MPI_Alltoallw_c, mpi_alltoallw_c)                                        \
+    F(MPI_Bcast_c, mpi_bcast_c)                                                \
+    F(MPI_Gather_c, mpi_gather_c)                                              \
+    F(MPI_Gatherv_c, mpi_gatherv_c)                                            \
+    F(MPI_Reduce_c, mpi_reduce_c)                                              \
+    F(MPI_Reduce_scatter_c, mpi_reduce_scatter_c)                              \
+    F(MPI_Reduce_scatter_block_c, mpi_reduce_scatter_block_c)                  \
+    F(MPI_Scatter_c, mpi_scatter_c)                                            \
+    F(MPI_Scatterv_c, mpi_scatterv_c)                                          \
+    F(MPI_Scan_c, mpi_scan_c)                                                  \
+    F(MPI_Exscan_c, mpi_exscan_c)                                              \
+    F(MPI_Ibsend_c, mpi_ibsend_c)                                              \
+    F(MPI_Imrecv_c, mpi_imrecv_c)                                              \
+    F(MPI_Irecv_c, mpi_irecv_c)                                                \
+    F(MPI_Irsend_c, mpi_irsend_c)                                              \
+    F(MPI_Isend_c, mpi_isend_c)                                                \
+    F(MPI_Isendrecv_c, mpi_isendrecv_c)                                        \
+    F(MPI_Isendrecv_replace_c, mpi_isendrecv_replace_c)                        \
+    F(MPI_Issend_c, mpi_issend_c)                                              \
+    F(MPI_Iallgather_c, mpi_iallgather_c)                                      \
+    F(MPI_Iallgatherv_c, mpi_iallgatherv_c)                                    \
+    F(MPI_Iallreduce_c, mpi_iallreduce_c)                                      \
+    F(MPI_Ialltoall_c, mpi_ialltoall_c)                                        \
+    F(MPI_Ialltoallv_c, mpi_ialltoallv_c)                                      \
+    F(MPI_Ialltoallw_c, mpi_ialltoallw_c)                                      \
+    F(MPI_Ibcast_c, mpi_ibcast_c)                                              \
+    F(MPI_Igather_c, mpi_igather_c)                                            \
+    F(MPI_Igatherv_c, mpi_igatherv_c)                                          \
+    F(MPI_Ireduce_c, mpi_ireduce_c)                                            \
+    F(MPI_Ireduce_scatter_c, mpi_ireduce_scatter_c)                            \
+    F(MPI_Ireduce_scatter_block_c, mpi_ireduce_scatter_block_c)                \
+    F(MPI_Iscatter_c, mpi_iscatter_c)                                          \
+    F(MPI_Iscatterv_c, mpi_iscatterv_c)                                        \
+    F(MPI_Iscan_c, mpi_iscan_c)                                                \
+    F(MPI_Iexscan_c, mpi_iexscan_c)                                            \
+    F(MPI_Allgather_init_c, mpi_allgather_init_c)                              \
+    F(MPI_Allgatherv_init_c, mpi_allgatherv_init_c)                            \
+    F(MPI_Allreduce_init_c, mpi_allreduce_init_c)                              \
+    F(MPI_Alltoall_init_c, mpi_alltoall_init_c)                                \
+    F(MPI_Alltoallv_init_c, mpi_alltoallv_init_c)                              \
+    F(MPI_Alltoallw_init_c, mpi_alltoallw_init_c)                              \
+    F(MPI_Bcast_init_c, mpi_bcast_init_c)                                      \
+    F(MPI_Gather_init_c, mpi_gather_init_c)                                    \
+    F(MPI_Gatherv_init_c, mpi_gatherv_init_c)                                  \
+    F(MPI_Reduce_init_c, mpi_reduce_init_c)                                    \
+    F(MPI_Reduce_scatter_init_c, mpi_reduce_scatter_init_c)                    \
+    F(MPI_Reduce_scatter_block_init_c, mpi_reduce_scatter_block_init_c)        \
+    F(MPI_Scatter_init_c, mpi_scatter_init_c)                                  \
+    F(MPI_Scatterv_init_c, mpi_scatterv_init_c)                                \
+    F(MPI_Scan_init_c, mpi_scan_init_c)                                        \
+    F(MPI_Exscan_init_c, mpi_exscan_init_c)                                    \
+    F(MPI_Win_allocate_c, mpi_win_allocate_c)                                  \
+    F(MPI_Win_allocate_shared_c, mpi_win_allocate_shared_c)                    \
+    F(MPI_Win_create_c, mpi_win_create_c)                                      \
+    F(MPI_Accumulate_c, mpi_accumulate_c)                                      \
+    F(MPI_Get_c, mpi_get_c)                                                    \
+    F(MPI_Get_accumulate_c, mpi_get_accumulate_c)                              \
+    F(MPI_Put_c, mpi_put_c)                                                    \
+    F(MPI_Raccumulate_c, mpi_raccumulate_c)                                    \
+    F(MPI_Rget_c, mpi_rget_c)                                                  \
+    F(MPI_Rget_accumulate_c, mpi_rget_accumulate_c)                            \
+    F(MPI_Rput_c, mpi_rput_c)                                                  \
+    F(MPI_File_read_c, mpi_file_read_c)                                        \
+    F(MPI_File_read_at_c, mpi_file_read_at_c)                                  \
+    F(MPI_File_read_shared_c, mpi_file_read_shared_c)                          \
+    F(MPI_File_write_c, mpi_file_write_c)                                      \
+    F(MPI_File_write_at_c, mpi_file_write_at_c)                                \
+    F(MPI_File_write_shared_c, mpi_file_write_shared_c)                        \
+    F(MPI_File_read_all_c, mpi_file_read_all_c)                                \
+    F(MPI_File_read_at_all_c, mpi_file_read_at_all_c)                          \
+    F(MPI_File_read_ordered_c, mpi_file_read_ordered_c)                        \
+    F(MPI_File_write_all_c, mpi_file_write_all_c)                              \
+    F(MPI_File_write_at_all_c, mpi_file_write_at_all_c)                        \
+    F(MPI_File_write_ordered_c, mpi_file_write_ordered_c)                      \
+    F(MPI_File_iread_c, mpi_file_iread_c)                                      \
+    F(MPI_File_iread_at_c, mpi_file_iread_at_c)                                \
+    F(MPI_File_iread_shared_c, mpi_file_iread_shared_c)                        \
+    F(MPI_File_iwrite_c, mpi_file_iwrite_c)                                    \
+    F(MPI_File_iwrite_at_c, mpi_file_iwrite_at_c)                              \
+    F(MPI_File_iwrite_shared_c, mpi_file_iwrite_shared_c)                      \
+    F(MPI_File_iread_all_c, mpi_file_iread_all_c)                              \
+    F(MPI_File_iread_at_all_c, mpi_file_iread_at_all_c)                        \
+    F(MPI_File_iwrite_all_c, mpi_file_iwrite_all_c)                            \
+    F(MPI_File_iwrite_at_all_c, mpi_file_iwrite_at_all_c)                      \
+    F(MPI_File_read_all_begin_c, mpi_file_read_all_begin_c)                    \
+    F(MPI_File_read_at_all_begin_c, mpi_file_read_at_all_begin_c)              \
+    F(MPI_File_read_ordered_begin_c, mpi_file_read_ordered_begin_c)            \
+    F(MPI_File_write_all_begin_c, mpi_file_write_all_begin_c)                  \
+    F(MPI_File_write_at_all_begin_c, mpi_file_write_at_all_begin_c)            \
+    F(MPI_File_write_ordered_begin_c, mpi_file_write_ordered_begin_c)          \
+    F(MPI_Neighbor_allgather_c, mpi_neighbor_allgather_c)                      \
+    F(MPI_Neighbor_allgatherv_c, mpi_neighbor_allgatherv_c)                    \
+    F(MPI_Neighbor_alltoall_c, mpi_neighbor_alltoall_c)                        \
+    F(MPI_Neighbor_alltoallv_c, mpi_neighbor_alltoallv_c)                      \
+    F(MPI_Neighbor_alltoallw_c, mpi_neighbor_alltoallw_c)                      \
+    F(MPI_Ineighbor_allgather_c, mpi_ineighbor_allgather_c)                    \
+    F(MPI_Ineighbor_allgatherv_c, mpi_ineighbor_allgatherv_c)                  \
+    F(MPI_Ineighbor_alltoall_c, mpi_ineighbor_alltoall_c)                      \
+    F(MPI_Ineighbor_alltoallv_c, mpi_ineighbor_alltoallv_c)                    \
+    F(MPI_Ineighbor_alltoallw_c, mpi_ineighbor_alltoallw_c)                    \
+    F(MPI_Neighbor_allgather_init_c, mpi_neighbor_allgather_init_c)            \
+    F(MPI_Neighbor_allgatherv_init_c, mpi_neighbor_allgatherv_init_c)          \
+    F(MPI_Neighbor_alltoall_init_c, mpi_neighbor_alltoall_init_c)              \
+    F(MPI_Neighbor_alltoallv_init_c, mpi_neighbor_alltoallv_init_c)            \
+    F(MPI_Neighbor_alltoallw_init_c, mpi_neighbor_alltoallw_init_c)
+
+#if MPI_VERSION >= 4
+#define FOREACH_OPERATION(F)                                                   \
+    FOREACH_OPERATION_MPI3(F)                                                  \
+    FOREACH_OPERATION_MPI31(F)                                                 \
+    FOREACH_OPERATION_MPI4(F)
+#define FOREACH_LARGE_OPERATION(F) FOREACH_LARGE_OPERATION_MPI4(F)
+#elif MPI_VERSION == 3 && MPI_SUBVERSION >= 1
+#define FOREACH_OPERATION(F)                                                   \
+    FOREACH_OPERATION_MPI3(F)                                                  \
+    FOREACH_OPERATION_MPI31(F)
+#define FOREACH_LARGE_OPERATION(F)
+#else
+#define FOREACH_OPERATION(F) FOREACH_OPERATION_MPI3(F)
+#define FOREACH_LARGE_OPERATION(F)
+#endif
+
+//! The type of the Fortran interface of a C function. Fortran passes all the
+//! arguments by reference and appends the error code
+template <typename FuncTy>
+struct FortranInterface;
+
+template <typename... Params>
+struct FortranInterface<int(Params...)> {
+    template <typename Param>
+    using Argument = MPI_Fint *;
+
+    using Type = void(Argument<Params>..., MPI_Fint *);
+};
+
+//! The only variadic operation is MPI_Pcontrol, whose Fortran interface takes
+//! the level and no error code
+template <typename... Params>
+struct FortranInterface<int(Params..., ...)> {
+    template <typename Param>
+    using Argument = MPI_Fint *;
+
+    using Type = void(Argument<Params>...);
+};
+
+//! Declare the Fortran interfaces, which are not part of the C header. The
+//! alternative manglings and the mpi_f08 bindings have the same interface
+#define DECLARE_FORTRAN(c_name, name, NAME)                                    \
+    extern "C" FortranInterface<decltype(c_name)>::Type name##_;               \
+    extern "C" FortranInterface<decltype(c_name)>::Type name##__;              \
+    extern "C" FortranInterface<decltype(c_name)>::Type name;                  \
+    extern "C" FortranInterface<decltype(c_name)>::Type NAME;                  \
+    extern "C" FortranInterface<decltype(c_name)>::Type name##_f08_;
+
+#define DECLARE_LARGE_FORTRAN(c_name, name)                                    \
+    extern "C" FortranInterface<decltype(c_name)>::Type name##_f08_;
+
+FOREACH_OPERATION(DECLARE_FORTRAN)
+FOREACH_LARGE_OPERATION(DECLARE_LARGE_FORTRAN)
+
+#endif // BENCH_OPERATIONS_HPP
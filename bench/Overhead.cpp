@@ -0,0 +1,179 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mpi.h>
+#include <pthread.h>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "Common.hpp"
+#include "Operations.hpp"
+
+// Benchmark measuring the time per call of every intercepted C and Fortran
+// interface. All threads call the same interface concurrently, and each
+// interface prints a CSV row with the following columns:
+//
+//   mode,language,operation,threads,iterations,ns_per_call
+//
+// where the time per call is the average of the threads. The benchmark is
+// linked against the stub MPI library, with or without the Sonar library
+// in between, and the mode is only a label for the output
+
+namespace {
+
+//! Memory passed as buffers, arrays, statuses and Fortran arguments. All
+//! integers are one, so counts, ranks, tags and flags have valid values
+MPI_Fint scratch[1024];
+
+//! \brief Get the value passed as an argument of a given type
+template <typename T>
+T argument()
+{
+    if constexpr (std::is_same_v<T, MPI_Datatype>)
+        return MPI_BYTE;
+    else if constexpr (std::is_same_v<T, MPI_Comm>)
+        return MPI_COMM_WORLD;
+    else if constexpr (std::is_same_v<T, MPI_Op>)
+        return MPI_SUM;
+    else if constexpr (std::is_pointer_v<T>)
+        return (T) scratch;
+    else
+        return 1;
+}
+
+//! \brief Call a function repeatedly with the same arguments
+template <typename ReturnTy, typename... Params>
+void call(ReturnTy (*function)(Params...), uint64_t iterations)
+{
+    std::tuple<Params...> args(argument<Params>()...);
+    for (uint64_t i = 0; i < iterations; ++i)
+        std::apply(function, args);
+}
+
+//! \brief Call a variadic function repeatedly without optional arguments
+template <typename ReturnTy, typename... Params>
+void call(ReturnTy (*function)(Params..., ...), uint64_t iterations)
+{
+    std::tuple<Params...> args(argument<Params>()...);
+    for (uint64_t i = 0; i < iterations; ++i)
+        std::apply(function, args);
+}
+
+//! A benchmark of an interface
+struct Benchmark {
+    const char *_language;
+    const char *_operation;
+    void (*_run)(uint64_t iterations);
+};
+
+#define C_BENCHMARK(c_name)                                                    \
+    { "C", #c_name, [](uint64_t n) { call(&c_name, n); } },
+
+#define FORTRAN_BENCHMARK(fortran_name)                                        \
+    { "Fortran", #fortran_name, [](uint64_t n) { call(&fortran_name, n); } },
+
+//! The Fortran interfaces include the alternative manglings, which are aliases
+//! of the same wrapper, and the mpi_f08 bindings
+#define BENCHMARKS(c_name, name, NAME)                                         \
+    C_BENCHMARK(c_name)                                                        \
+    FORTRAN_BENCHMARK(name##_)                                                 \
+    FORTRAN_BENCHMARK(name##__)                                                \
+    FORTRAN_BENCHMARK(name)                                                    \
+    FORTRAN_BENCHMARK(NAME)                                                    \
+    FORTRAN_BENCHMARK(name##_f08_)
+
+#define LARGE_BENCHMARKS(c_name, name)                                         \
+    C_BENCHMARK(c_name)                                                        \
+    FORTRAN_BENCHMARK(name##_f08_)
+
+const Benchmark benchmarks[] = {
+    FOREACH_OPERATION(BENCHMARKS)
+    FOREACH_LARGE_OPERATION(LARGE_BENCHMARKS)
+};
+
+//! The number of calls before measuring each interface
+const uint64_t WarmupIterations = 1000;
+
+//! The state shared by the threads
+struct Context {
+    const char *_mode;
+    int _threads;
+    uint64_t _iterations;
+    pthread_barrier_t _barrier;
+    std::vector<uint64_t> _elapsed;
+};
+
+//! \brief Run all benchmarks in a thread
+void worker(Context &context, int id)
+{
+    for (const Benchmark &benchmark : benchmarks) {
+        benchmark._run(WarmupIterations);
+
+        pthread_barrier_wait(&context._barrier);
+
+        uint64_t start = bench::now();
+        benchmark._run(context._iterations);
+        context._elapsed[id] = bench::now() - start;
+
+        pthread_barrier_wait(&context._barrier);
+
+        if (id == 0) {
+            uint64_t elapsed = 0;
+            for (uint64_t value : context._elapsed)
+                elapsed += value;
+
+            double ns = (double) elapsed / (context._threads * context._iterations);
+            printf("%s,%s,%s,%d,%" PRIu64 ",%.2f\n", context._mode,
+                   benchmark._language, benchmark._operation,
+                   context._threads, context._iterations, ns);
+        }
+    }}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc != 4) {
+        fprintf(stderr, "usage: %s MODE THREADS ITERATIONS\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Context context;
+    context._mode = argv[1];
+    context._threads = atoi(argv[2]);
+    context._iterations = strtoull(argv[3], nullptr, 10);
+    if (context._threads <= 0 || context._iterations == 0) {
+        fprintf(stderr, "Invalid number of threads or iterations\n");
+        return EXIT_FAILURE;
+    }
+
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+
+    context._elapsed.resize(context._threads);
+    pthread_barrier_init(&context._barrier, nullptr, context._threads);
+
+    std::vector<std::thread> threads;
+    for (int id = 1; id < context._threads; ++id)
+        threads.emplace_back(worker, std::ref(context), id);
+
+    worker(context, 0);
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    pthread_barrier_destroy(&context._barrier);
+
+    MPI_Finalize();
+
+    return EXIT_SUCCESS;
+}
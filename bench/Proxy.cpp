@@ -0,0 +1,216 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mpi.h>
+#include <thread>
+#include <vector>
+
+#include "Common.hpp"
+
+// Proxy applications reproducing the communication patterns of common
+// parallel codes, with a configurable amount of computation per iteration.
+// The following workloads are supported:
+//
+//   halo:      1D stencil exchanging the halos with both ring neighbors
+//              through MPI_Irecv, MPI_Isend and MPI_Waitall
+//   allreduce: iterative solver computing two global dot products per
+//              iteration through MPI_Allreduce
+//   hybrid:    the halo workload executed concurrently by several threads
+//              of each rank, using the thread identifier as message tag
+//
+// Rank zero prints a CSV row with the following columns:
+//
+//   mode,workload,ranks,threads,iterations,seconds,calls
+//
+// where the calls are the MPI calls of the workload issued by each rank
+
+namespace {
+
+//! The number of elements of each halo
+const int HaloWidth = 16;
+
+//! The parameters of the execution
+struct Context {
+    const char *_mode;
+    const char *_workload;
+    uint64_t _iterations;
+    int _size;
+    int _threads;
+    int _rank;
+    int _nranks;
+};
+
+//! The result of the computations, which prevents the compiler from removing
+//! them
+volatile double sink;
+
+//! \brief Compute a three-point stencil of the cells excluding the halos
+void stencil(const std::vector<double> &cells, std::vector<double> &next)
+{
+    for (size_t i = HaloWidth; i < cells.size() - HaloWidth; ++i)
+        next[i] = (cells[i - 1] + cells[i] + cells[i + 1]) / 3.0;
+}
+
+//! \brief Run the halo exchange workload and return the number of MPI calls
+uint64_t halo(const Context &context, int tag)
+{
+    std::vector<double> cells(context._size + 2 * HaloWidth, 1.0);
+    std::vector<double> next(cells);
+
+    const int left = (context._rank + context._nranks - 1) % context._nranks;
+    const int right = (context._rank + 1) % context._nranks;
+    double *first = cells.data() + HaloWidth;
+    double *last = cells.data() + context._size;
+
+    for (uint64_t it = 0; it < context._iterations; ++it) {
+        MPI_Request requests[4];
+        MPI_Irecv(cells.data(), HaloWidth, MPI_DOUBLE, left, tag,
+                  MPI_COMM_WORLD, &requests[0]);
+        MPI_Irecv(last + HaloWidth, HaloWidth, MPI_DOUBLE, right, tag,
+                  MPI_COMM_WORLD, &requests[1]);
+        MPI_Isend(first, HaloWidth, MPI_DOUBLE, left, tag,
+                  MPI_COMM_WORLD, &requests[2]);
+        MPI_Isend(last, HaloWidth, MPI_DOUBLE, right, tag,
+                  MPI_COMM_WORLD, &requests[3]);
+        MPI_Waitall(4, requests, MPI_STATUSES_IGNORE);
+
+        stencil(cells, next);
+        cells.swap(next);
+        first = cells.data() + HaloWidth;
+        last = cells.data() + context._size;
+    }
+    sink = cells[HaloWidth];
+
+    return context._iterations * 5;
+}
+
+//! \brief Run the allreduce workload and return the number of MPI calls
+uint64_t allreduce(const Context &context)
+{
+    std::vector<double> x(context._size, 0.0);
+    std::vector<double> r(context._size, 1.0);
+    std::vector<double> p(r);
+
+    for (uint64_t it = 0; it < context._iterations; ++it) {
+        double local = 0.0, global;
+        for (int i = 0; i < context._size; ++i)
+            local += p[i] * r[i];
+
+        global = local;
+        MPI_Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        double alpha = 1.0 / (1.0 + global);
+
+        local = 0.0;
+        for (int i = 0; i < context._size; ++i) {
+            x[i] += alpha * p[i];
+            r[i] -= alpha * r[i];
+            local += r[i] * r[i];
+        }
+
+        global = local;
+        MPI_Allreduce(&local, &global, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        double beta = global / (1.0 + global);
+
+        for (int i = 0; i < context._size; ++i)
+            p[i] = r[i] + beta * p[i];
+    }
+    sink = x[0];
+
+    return context._iterations * 2;
+}
+
+//! \brief Run the hybrid workload and return the number of MPI calls
+uint64_t hybrid(const Context &context)
+{
+    std::vector<uint64_t> calls(context._threads);
+    std::vector<std::thread> threads;
+
+    for (int id = 1; id < context._threads; ++id) {
+        threads.emplace_back([&context, &calls, id]() {
+            calls[id] = halo(context, id);
+        });
+    }
+
+    calls[0] = halo(context, 0);
+
+    uint64_t total = 0;
+    for (int id = 0; id < context._threads; ++id) {
+        if (id > 0)
+            threads[id - 1].join();
+        total += calls[id];
+    }
+    return total;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 4 || argc > 6) {
+        fprintf(stderr, "usage: %s MODE WORKLOAD ITERATIONS [SIZE] [THREADS]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Context context;
+    context._mode = argv[1];
+    context._workload = argv[2];
+    context._iterations = strtoull(argv[3], nullptr, 10);
+    context._size = (argc > 4) ? atoi(argv[4]) : 4096;
+    context._threads = (argc > 5) ? atoi(argv[5]) : 4;
+    if (context._iterations == 0 || context._size < HaloWidth || context._threads <= 0) {
+        fprintf(stderr, "Invalid number of iterations, size or threads\n");
+        return EXIT_FAILURE;
+    }
+
+    bool isHybrid = (strcmp(context._workload, "hybrid") == 0);
+    if (!isHybrid)
+        context._threads = 1;
+
+    int provided;
+    int required = isHybrid ? MPI_THREAD_MULTIPLE : MPI_THREAD_SINGLE;
+    MPI_Init_thread(&argc, &argv, required, &provided);
+    if (provided < required) {
+        fprintf(stderr, "The MPI library does not support multiple threads\n");
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &context._rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &context._nranks);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    uint64_t start = bench::now();
+
+    uint64_t calls;
+    if (strcmp(context._workload, "halo") == 0) {
+        calls = halo(context, 0);
+    } else if (strcmp(context._workload, "allreduce") == 0) {
+        calls = allreduce(context);
+    } else if (isHybrid) {
+        calls = hybrid(context);
+    } else {
+        fprintf(stderr, "Invalid workload %s\n", context._workload);
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+        return EXIT_FAILURE;
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    uint64_t end = bench::now();
+
+    if (context._rank == 0) {
+        printf("%s,%s,%d,%d,%" PRIu64 ",%.6f,%" PRIu64 "\n", context._mode,
+               context._workload, context._nranks, context._threads,
+               context._iterations, (end - start) / 1e9, calls);
+    }
+
+    MPI_Finalize();
+
+    return EXIT_SUCCESS;
+}
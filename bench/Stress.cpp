@@ -0,0 +1,202 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <cinttypes>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mpi.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Common.hpp"
+
+// Stress workload calling MPI concurrently from many threads of each rank.
+// The threads are created in several waves, and each thread only lives
+// during its wave, so the instrumentation of the threads is initialized and
+// finalized repeatedly while the other threads are communicating. In each
+// iteration, every thread exchanges a message with the ring neighbors
+// through MPI_Irecv, MPI_Isend, MPI_Test and MPI_Waitall, and reduces a value
+// with MPI_Allreduce in its own communicator.
+//
+// The optional LINGER argument sets when the threads of the last wave exit
+// after finishing their iterations. With 0 (default), they exit before the
+// main thread calls MPI_Finalize. With 1, they exit after MPI_Finalize, so
+// their instrumentation is finalized after the process. With 2, they stay
+// alive until the program exits, like the workers of a thread pool, so their
+// instrumentation is never finalized.
+//
+// Rank zero prints a CSV row with the following columns:
+//
+//   mode,ranks,threads,waves,iterations,seconds,calls
+//
+// where the calls are the MPI calls of the workload issued by each rank
+
+namespace {
+
+//! The parameters of the execution
+struct Context {
+    const char *_mode;
+    int _threads;
+    int _waves;
+    uint64_t _iterations;
+    int _rank;
+    int _nranks;
+    std::vector<MPI_Comm> _comms;
+};
+
+//! When the threads of the last wave exit
+enum class Exit {
+    BeforeFinalize = 0,
+    AfterFinalize,
+    AtProgramExit,
+};
+
+//! The threads that outlive the MPI finalization
+struct Linger {
+    std::mutex _lock;
+    std::condition_variable _condition;
+    int _finished = 0;
+    bool _finalized = false;
+};
+
+//! The number of MPI calls of each iteration
+const uint64_t CallsPerIteration = 5;
+
+//! \brief Run the workload of a thread
+void worker(const Context &context, int id, Linger *linger)
+{
+    const int left = (context._rank + context._nranks - 1) % context._nranks;
+    const int right = (context._rank + 1) % context._nranks;
+
+    for (uint64_t it = 0; it < context._iterations; ++it) {
+        int sent = context._rank, received = -1, flag = 0;
+        MPI_Request requests[2] = { MPI_REQUEST_NULL, MPI_REQUEST_NULL };
+
+        MPI_Irecv(&received, 1, MPI_INT, left, id, MPI_COMM_WORLD, &requests[0]);
+        MPI_Isend(&sent, 1, MPI_INT, right, id, MPI_COMM_WORLD, &requests[1]);
+        MPI_Test(&requests[0], &flag, MPI_STATUS_IGNORE);
+        MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+
+        int value = 1, total = 0;
+        MPI_Allreduce(&value, &total, 1, MPI_INT, MPI_SUM, context._comms[id]);
+    }
+
+    if (linger != nullptr) {
+        std::unique_lock<std::mutex> guard(linger->_lock);
+        ++linger->_finished;
+        linger->_condition.notify_all();
+        linger->_condition.wait(guard, [&] { return linger->_finalized; });
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc != 5 && argc != 6) {
+        fprintf(stderr, "usage: %s MODE THREADS WAVES ITERATIONS [LINGER]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    Context context;
+    context._mode = argv[1];
+    context._threads = atoi(argv[2]);
+    context._waves = atoi(argv[3]);
+    context._iterations = strtoull(argv[4], nullptr, 10);
+    Exit lastExit = (argc == 6) ? (Exit) atoi(argv[5]) : Exit::BeforeFinalize;
+    if (context._threads <= 0 || context._waves <= 0 || context._iterations == 0) {
+        fprintf(stderr, "Invalid number of threads, waves or iterations\n");
+        return EXIT_FAILURE;
+    }
+    if (lastExit < Exit::BeforeFinalize || lastExit > Exit::AtProgramExit) {
+        fprintf(stderr, "Invalid linger mode\n");
+        return EXIT_FAILURE;
+    }
+    bool lingering = (lastExit != Exit::BeforeFinalize);
+
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+        fprintf(stderr, "The MPI library does not support multiple threads\n");
+        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+    }
+
+    MPI_Comm_rank(MPI_COMM_WORLD, &context._rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &context._nranks);
+
+    // Each thread identifier has its own communicator, since the threads
+    // cannot call collectives concurrently in the same communicator. The
+    // stub MPI library leaves them as the world communicator
+    context._comms.resize(context._threads, MPI_COMM_WORLD);
+    for (MPI_Comm &comm : context._comms)
+        MPI_Comm_dup(MPI_COMM_WORLD, &comm);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    uint64_t start = bench::now();
+
+    // The state is never freed, since the threads that stay alive until the
+    // program exit wait on it
+    Linger &linger = *new Linger();
+    std::vector<std::thread> threads;
+    for (int wave = 0; wave < context._waves; ++wave) {
+        bool last = (wave == context._waves - 1);
+        Linger *lingerer = (lingering && last) ? &linger : nullptr;
+
+        for (int id = 0; id < context._threads; ++id)
+            threads.emplace_back(worker, std::cref(context), id, lingerer);
+
+        if (lingerer == nullptr) {
+            for (std::thread &thread : threads)
+                thread.join();
+            threads.clear();
+        }
+    }
+
+    // Wait until the lingering threads finish their MPI calls
+    if (lingering) {
+        std::unique_lock<std::mutex> guard(linger._lock);
+        linger._condition.wait(guard, [&] { return linger._finished == context._threads; });
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    uint64_t end = bench::now();
+
+    uint64_t calls = context._threads * context._waves * context._iterations * CallsPerIteration;
+    if (context._rank == 0) {
+        printf("%s,%d,%d,%d,%" PRIu64 ",%.6f,%" PRIu64 "\n", context._mode,
+               context._nranks, context._threads, context._waves,
+               context._iterations, (end - start) / 1e9, calls);
+    }
+
+    for (MPI_Comm &comm : context._comms)
+        MPI_Comm_free(&comm);
+
+    MPI_Finalize();
+
+    // Leave the lingering threads waiting until the program exit
+    if (lastExit == Exit::AtProgramExit) {
+        for (std::thread &thread : threads)
+            thread.detach();
+        return EXIT_SUCCESS;
+    }
+
+    // Let the lingering threads exit after the finalization
+    if (lingering) {
+        {
+            std::lock_guard<std::mutex> guard(linger._lock);
+            linger._finalized = true;
+        }
+        linger._condition.notify_all();
+
+        for (std::thread &thread : threads)
+            thread.join();
+    }
+
+    return EXIT_SUCCESS;
+}
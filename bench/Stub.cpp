@@ -0,0 +1,166 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <cstdlib>
+#include <cstring>
+#include <mpi.h>
+
+#include "Operations.hpp"
+
+// Stand-in for the MPI library used by the benchmarks. All communication
+// operations return immediately, so the benchmarks measure the cost of the
+// Sonar wrappers without a launcher or a network. The process is the only
+// rank of the world communicator
+
+#pragma GCC visibility push(default)
+
+extern "C" {
+
+//! The common implementation of the C operations
+int sonar_stub_c()
+{
+    return MPI_SUCCESS;
+}
+
+//! The common implementation of the Fortran operations, which leave the error
+//! code untouched
+void sonar_stub_fortran()
+{
+}
+
+//! Define the C and Fortran operations as aliases of the common stubs. The
+//! stubs ignore the arguments, which is safe in the C calling conventions.
+//! The Fortran operations include the alternative manglings and the mpi_f08
+//! bindings
+#define DEFINE_FORTRAN_STUB(c_name, fortran_name)                              \
+    FortranInterface<decltype(c_name)>::Type fortran_name                      \
+        __attribute__((alias("sonar_stub_fortran")));
+
+#define DEFINE_STUB(c_name, name, NAME)                                        \
+    decltype(c_name) c_name __attribute__((alias("sonar_stub_c")));            \
+    DEFINE_FORTRAN_STUB(c_name, name##_)                                       \
+    DEFINE_FORTRAN_STUB(c_name, name##__)                                      \
+    DEFINE_FORTRAN_STUB(c_name, name)                                          \
+    DEFINE_FORTRAN_STUB(c_name, NAME)                                          \
+    DEFINE_FORTRAN_STUB(c_name, name##_f08_)
+
+#define DEFINE_LARGE_STUB(c_name, name)                                        \
+    decltype(c_name) c_name __attribute__((alias("sonar_stub_c")));            \
+    DEFINE_FORTRAN_STUB(c_name, name##_f08_)
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattribute-alias"
+
+FOREACH_OPERATION(DEFINE_STUB)
+FOREACH_LARGE_OPERATION(DEFINE_LARGE_STUB)
+
+#pragma GCC diagnostic pop
+
+int MPI_Init(int *, char ***)
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Init_thread(int *, char ***, int required, int *provided)
+{
+    *provided = required;
+    return MPI_SUCCESS;
+}
+
+int MPI_Finalize()
+{
+    return MPI_SUCCESS;
+}
+
+int MPI_Abort(MPI_Comm, int code)
+{
+    std::exit(code);
+}
+
+int MPI_Comm_rank(MPI_Comm, int *rank)
+{
+    *rank = 0;
+    return MPI_SUCCESS;
+}
+
+int MPI_Comm_size(MPI_Comm, int *size)
+{
+    *size = 1;
+    return MPI_SUCCESS;
+}
+
+MPI_Fint MPI_Comm_c2f(MPI_Comm comm)
+{
+    return (comm == MPI_COMM_WORLD) ? 0 : 1;
+}
+
+MPI_Comm MPI_Comm_f2c(MPI_Fint comm)
+{
+    return (comm == 0) ? MPI_COMM_WORLD : MPI_COMM_NULL;
+}
+
+MPI_Datatype MPI_Type_f2c(MPI_Fint)
+{
+    return MPI_BYTE;
+}
+
+int PMPI_Type_size_x(MPI_Datatype, MPI_Count *size)
+{
+    *size = 1;
+    return MPI_SUCCESS;
+}
+
+int MPI_Status_f2c(const MPI_Fint *, MPI_Status *status)
+{
+    std::memset(status, 0, sizeof(MPI_Status));
+    return MPI_SUCCESS;
+}
+
+#if MPI_VERSION >= 4
+int MPI_Status_f082c(const MPI_F08_status *, MPI_Status *status)
+{
+    std::memset(status, 0, sizeof(MPI_Status));
+    return MPI_SUCCESS;
+}
+#endif
+
+int PMPI_Get_elements_x(const MPI_Status *, MPI_Datatype, MPI_Count *count)
+{
+    *count = 1;
+    return MPI_SUCCESS;
+}
+
+void mpi_init_(MPI_Fint *err)
+{
+    *err = MPI_SUCCESS;
+}
+
+void mpi_init_thread_(MPI_Fint *required, MPI_Fint *provided, MPI_Fint *err)
+{
+    *provided = *required;
+    *err = MPI_SUCCESS;
+}
+
+void mpi_finalize_(MPI_Fint *err)
+{
+    *err = MPI_SUCCESS;
+}
+
+void mpi_comm_rank_(MPI_Fint *, MPI_Fint *rank, MPI_Fint *err)
+{
+    *rank = 0;
+    *err = MPI_SUCCESS;
+}
+
+void mpi_comm_size_(MPI_Fint *, MPI_Fint *size, MPI_Fint *err)
+{
+    *size = 1;
+    *err = MPI_SUCCESS;
+}
+
+} // extern C
+
+#pragma GCC visibility pop
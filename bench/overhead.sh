@@ -0,0 +1,43 @@
+#!/bin/sh
+#	This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+#
+#	Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+#
+# Run the per-call overhead benchmark without Sonar (baseline) and with Sonar
+# in the none and ovni modes, from one thread to the maximum number of threads
+# in powers of two. The ovni mode runs with both the ovni clock and the
+# timestamp counter (ovni-tsc). The results are printed in CSV format.
+#
+# usage: overhead.sh BENCH_DIR [MAX_THREADS] [ITERATIONS]
+
+set -e
+
+benchdir=$(cd "$1" && pwd)
+maxthreads=${2:-$(nproc)}
+iterations=${3:-100000}
+
+# Run in a temporary directory, since ovni writes the trace in the working
+# directory
+workdir=$(mktemp -d)
+trap 'rm -rf "$workdir"' EXIT
+cd "$workdir"
+
+threads_list() {
+	threads=1
+	while [ "$threads" -lt "$maxthreads" ]; do
+		echo "$threads"
+		threads=$((threads * 2))
+	done
+	echo "$maxthreads"
+}
+
+echo "mode,language,operation,threads,iterations,ns_per_call"
+
+for threads in $(threads_list); do
+	"$benchdir/overhead-base" baseline "$threads" "$iterations"
+	SONAR_MPI_INSTRUMENT=none "$benchdir/overhead" none "$threads" "$iterations"
+	SONAR_MPI_INSTRUMENT=ovni "$benchdir/overhead" ovni "$threads" "$iterations"
+	rm -rf ovni
+	SONAR_MPI_INSTRUMENT=ovni SONAR_MPI_CLOCK=tsc "$benchdir/overhead" ovni-tsc "$threads" "$iterations"
+	rm -rf ovni
+done
@@ -0,0 +1,74 @@
+#!/bin/sh
+#	This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+#
+#	Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+#
+# Run the proxy applications without Sonar (baseline) and with Sonar in the
+# none and ovni modes. The results are printed in CSV format, including the
+# slowdown over the baseline, the MPI calls and ovni events per second, and
+# the bytes of trace per rank and second. The events are counted with the
+# ovnidump tool when it is available.
+#
+# The applications run against the stub MPI library by default. Defining the
+# BENCH_MPIRUN variable (e.g., "mpirun -n 4") runs them with the real MPI
+# library through the given launcher.
+#
+# usage: proxy.sh BENCH_DIR [ITERATIONS] [SIZE] [THREADS]
+
+set -e
+
+benchdir=$(cd "$1" && pwd)
+iterations=${2:-100000}
+size=${3:-4096}
+threads=${4:-4}
+
+if [ -n "$BENCH_MPIRUN" ]; then
+	proxy="$BENCH_MPIRUN $benchdir/proxy-mpi"
+	proxybase="$BENCH_MPIRUN $benchdir/proxy-mpi-base"
+else
+	proxy="$benchdir/proxy"
+	proxybase="$benchdir/proxy-base"
+fi
+
+# Run in a temporary directory, since ovni writes the trace in the working
+# directory
+workdir=$(mktemp -d)
+trap 'rm -rf "$workdir"' EXIT
+cd "$workdir"
+
+# Print the result of a run given the baseline time, the trace size and the
+# number of events
+report() {
+	echo "$1" | awk -F, -v base="$2" -v bytes="$3" -v events="$4" '{
+		seconds = $6; ranks = $3
+		eps = (events == "") ? "" : sprintf("%.0f", events / seconds)
+		bps = (bytes == "") ? "" : sprintf("%.0f", bytes / (ranks * seconds))
+		printf "%s,%s,%d,%d,%.6f,%.3f,%.0f,%s,%s\n", $2, $1, ranks, $4,
+			seconds, seconds / base, $7 * ranks / seconds, eps, bps
+	}'
+}
+
+echo "workload,mode,ranks,threads,seconds,slowdown,calls_per_second,events_per_second,trace_bytes_per_rank_second"
+
+for workload in halo allreduce hybrid; do
+	args="$workload $iterations $size $threads"
+
+	result=$($proxybase baseline $args)
+	base=$(echo "$result" | cut -d, -f6)
+	report "$result" "$base" "" ""
+
+	result=$(SONAR_MPI_INSTRUMENT=none $proxy none $args)
+	report "$result" "$base" "" ""
+
+	rm -rf ovni
+	result=$(SONAR_MPI_INSTRUMENT=ovni $proxy ovni $args)
+	bytes=0
+	if [ -d ovni ]; then
+		bytes=$(find ovni -type f -exec cat {} + | wc -c)
+	fi
+	events=""
+	if command -v ovnidump >/dev/null 2>&1 && [ -d ovni ]; then
+		events=$(ovnidump ovni 2>/dev/null | wc -l)
+	fi
+	report "$result" "$base" "$bytes" "$events"
+done
@@ -0,0 +1,115 @@
+#!/bin/sh
+#	This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+#
+#	Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+#
+# Run the stress workload without Sonar (baseline) and with Sonar in the
+# none, ovni and stats modes. The results are printed in CSV format, including
+# the slowdown over the baseline, the MPI calls per second and, in the ovni
+# mode, the number of thread streams in the trace. The ovni-linger mode runs
+# the ovni mode with the threads of the last wave exiting after MPI_Finalize.
+# The ovni-persist mode runs it with the threads of the last wave alive until
+# the program exit, like the workers of a thread pool, whose streams are never
+# flushed. Each rank must have one stream per created thread plus the main
+# thread in all ovni modes, so the script fails if a trace is missing or has
+# another number of streams. It also fails if a rank of the ovni-persist mode
+# does not warn about the unflushed streams of its alive threads.
+#
+# The workload runs against the stub MPI library by default. Defining the
+# BENCH_MPIRUN variable (e.g., "mpirun -n 4") runs it with the real MPI
+# library through the given launcher.
+#
+# usage: stress.sh BENCH_DIR [THREADS] [WAVES] [ITERATIONS]
+
+set -e
+
+benchdir=$(cd "$1" && pwd)
+threads=${2:-64}
+waves=${3:-4}
+iterations=${4:-1000}
+
+if [ -n "$BENCH_MPIRUN" ]; then
+	stress="$BENCH_MPIRUN $benchdir/stress-mpi"
+	stressbase="$BENCH_MPIRUN $benchdir/stress-mpi-base"
+else
+	stress="$benchdir/stress"
+	stressbase="$benchdir/stress-base"
+fi
+
+# Run in a temporary directory, since ovni writes the trace in the working
+# directory
+workdir=$(mktemp -d)
+trap 'rm -rf "$workdir"' EXIT
+cd "$workdir"
+
+# Print the result of a run given the baseline time and the number of thread
+# streams
+report() {
+	echo "$1" | awk -F, -v base="$2" -v streams="$3" '{
+		seconds = $6; ranks = $2
+		printf "%s,%d,%d,%d,%.6f,%.3f,%.0f,%s\n", $1, ranks, $3, $4,
+			seconds, seconds / base, $7 * ranks / seconds, streams
+	}'
+}
+
+echo "mode,ranks,threads,waves,seconds,slowdown,calls_per_second,thread_streams"
+
+args="$threads $waves $iterations"
+
+result=$($stressbase baseline $args)
+base=$(echo "$result" | cut -d, -f6)
+report "$result" "$base" ""
+
+result=$(SONAR_MPI_INSTRUMENT=none $stress none $args)
+report "$result" "$base" ""
+
+# Print the number of thread streams of the ovni trace
+count_streams() {
+	if [ -d ovni ]; then
+		find ovni -name 'thread.*' | wc -l
+	fi
+}
+
+# Check the number of thread streams of a run given its result and mode
+failed=0
+check_streams() {
+	ranks=$(echo "$1" | cut -d, -f2)
+	expected=$((ranks * (threads * waves + 1)))
+	if [ -z "$2" ]; then
+		echo "error: the $3 mode did not write an ovni trace" >&2
+		failed=1
+	elif [ "$2" -ne "$expected" ]; then
+		echo "error: the $3 mode wrote $2 thread streams instead of $expected" >&2
+		failed=1
+	fi
+}
+
+rm -rf ovni
+result=$(SONAR_MPI_INSTRUMENT=ovni $stress ovni $args)
+streams=$(count_streams)
+report "$result" "$base" "$streams"
+check_streams "$result" "$streams" ovni
+
+rm -rf ovni
+result=$(SONAR_MPI_INSTRUMENT=ovni $stress ovni-linger $args 1)
+streams=$(count_streams)
+report "$result" "$base" "$streams"
+check_streams "$result" "$streams" ovni-linger
+
+rm -rf ovni
+result=$(SONAR_MPI_INSTRUMENT=ovni $stress ovni-persist $args 2 2>warnings)
+streams=$(count_streams)
+report "$result" "$base" "$streams"
+check_streams "$result" "$streams" ovni-persist
+
+ranks=$(echo "$result" | cut -d, -f2)
+warned=$(grep -c "^Warning: $threads threads that traced calls are alive at the program exit" warnings || true)
+if [ "$warned" -ne "$ranks" ]; then
+	echo "error: the ovni-persist mode warned about the alive threads in $warned ranks instead of $ranks" >&2
+	failed=1
+fi
+
+result=$(SONAR_MPI_INSTRUMENT=stats SONAR_MPI_STATS_DIR="$workdir" $stress stats $args)
+report "$result" "$base" ""
+
+exit $failed
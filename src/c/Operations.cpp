@@ -10,11 +10,18 @@
 #include <stdlib.h>
 #include <type_traits>
 
+#include "Communicator.hpp"
+#include "Communicators.hpp"
+#include "Datatype.hpp"
 #include "Definitions.hpp"
+#include "Imbalance.hpp"
 #include "Instrument.hpp"
 #include "IOHandler.hpp"
 #include "Manager.hpp"
 #include "Operation.hpp"
+#include "Persistent.hpp"
+#include "Requests.hpp"
+#include "Topology.hpp"
 
 //! The version MPI 3.0 changes the communication functions to leverage const
 //! send buffers and for arrays of counts and displacements
@@ -27,6 +34,8 @@
 using recvbuf_t = void *;
 using sendbuf_t = MPI3CONST void *;
 using request_t = MPI_Request *;
+using request_handle_t = MPI_Request;
+using message_t = MPI_Message *;
 using requests_t = MPI_Request *;
 using status_t = MPI_Status *;
 using statuses_t = MPI_Status *;
@@ -36,18 +45,41 @@ using flag_t = int *;
 using tag_t = int;
 using rank_t = int;
 using op_t = MPI_Op;
+using info_t = MPI_Info;
 using indices_t = int *;
 using count_t = int;
 using count_c_t = MPI_Count;
+using partition_t = int;
+using win_t = MPI_Win *;
+using win_handle_t = MPI_Win;
+using group_t = MPI_Group;
+using aint_t = MPI_Aint;
+using baseptr_t = void *;
+using assert_t = int;
+using lock_t = int;
+using file_t = MPI_File *;
+using file_handle_t = MPI_File;
+using offset_t = MPI_Offset;
+using string_t = const char *;
+using amode_t = int;
+using newcomm_t = MPI_Comm *;
+using reorder_t = int;
+using color_t = int;
+using splitkey_t = int;
 
 using datas_t = MPI3CONST data_t *;
 using counts_t = MPI3CONST count_t *;
 using counts_c_t = MPI3CONST count_c_t *;
 using displs_t = MPI3CONST int *;
 using displs_c_t = MPI3CONST MPI_Aint *;
+using partitions_t = MPI3CONST int *;
+using ints_t = MPI3CONST int *;
 
 using namespace sonar;
 
+//! The name of the profiling symbol of a C function
+#define PROFILING_NAME(name) P##name
+
 static inline std::pair<int, int> getInformation()
 {
     int rank, nranks, err;
@@ -66,13 +98,17 @@ static inline std::pair<int, int> getInformation()
 
 extern "C" {
 
-//! Initializing and finalizing
+//! Initializing and finalizing. The wrappers are pinned, so the finalization
+//! is intercepted even if the other calls are rebound
+DECLARE_PINNED_TARGET(int, MPI_Init, int *, char ***)
 int MPI_Init(int *argc, char ***argv)
 {
     Instrument::preinitialize();
+    Symbol::loadAll(Instrument::rebind());
 
     int err = Manager::process<Operation::C, Operation::Init,
-                               Operation::Regular, int>("MPI_Init", argc, argv);
+                               Operation::Regular, int>(MPI_Init_target, argc,
+                                                        argv);
 
     auto [rank, nranks] = getInformation();
     Instrument::initialize(rank, nranks);
@@ -80,13 +116,15 @@ int MPI_Init(int *argc, char ***argv)
     return err;
 }
 
+DECLARE_PINNED_TARGET(int, MPI_Init_thread, int *, char ***, int, int *)
 int MPI_Init_thread(int *argc, char ***argv, int required, int *provided)
 {
     Instrument::preinitialize();
+    Symbol::loadAll(Instrument::rebind());
 
     int err = Manager::process<Operation::C, Operation::InitThread,
-                               Operation::Regular, int>("MPI_Init_thread", argc,
-                                                        argv, required,
+                               Operation::Regular, int>(MPI_Init_thread_target,
+                                                        argc, argv, required,
                                                         provided);
 
     auto [rank, nranks] = getInformation();
@@ -95,16 +133,75 @@ int MPI_Init_thread(int *argc, char ***argv, int required, int *provided)
     return err;
 }
 
+DECLARE_PINNED_TARGET(int, MPI_Finalize)
 int MPI_Finalize(void)
 {
+    Instrument::prefinalize();
+
     int err = Manager::process<Operation::C, Operation::Finalize,
-                               Operation::Regular, int>("MPI_Finalize");
+                               Operation::Regular, int>(MPI_Finalize_target);
 
     Instrument::finalize();
 
     return err;
 }
 
+//! Freeing datatypes invalidates the cached datatype sizes
+DECLARE_TARGET(int, MPI_Type_free, data_t *)
+int MPI_Type_free(data_t *type)
+{
+    int err = (*MPI_Type_free_target.get())(type);
+
+    Datatype::invalidate();
+
+    return err;
+}
+
+//! Freed requests are not tracked anymore
+DECLARE_TARGET(int, MPI_Request_free, request_t)
+int MPI_Request_free(request_t request)
+{
+    if (Requests::enabled())
+        Requests::forget(*request);
+    if (Persistent::enabled())
+        Persistent::forget(*request);
+
+    return (*MPI_Request_free_target.get())(request);
+}
+
+//! Freeing communicators invalidates the cached rank translations, the
+//! collective state, the neighbors and the job-wide identifier of the
+//! communicator
+DECLARE_TARGET(int, MPI_Comm_free, newcomm_t)
+int MPI_Comm_free(newcomm_t comm)
+{
+    int32_t id = MPI_Comm_c2f(*comm);
+
+    int err = Manager::process<Operation::C, Operation::CommFree,
+                               Operation::Regular, int>(MPI_Comm_free_target, comm);
+
+    Communicator::invalidate();
+    if (Imbalance::enabled())
+        Imbalance::release(id);
+    if (Topology::enabled())
+        Topology::release(id);
+    if (Communicators::enabled())
+        Communicators::release(id);
+
+    return err;
+}
+
+//! Profiling control calls start and stop the instrumentation. The optional
+//! arguments have no standard meaning and are not forwarded
+DECLARE_TARGET(int, MPI_Pcontrol, const int, ...)
+int MPI_Pcontrol(const int level, ...)
+{
+    if (Instrument::enabled())
+        Instrument::pcontrol(level);
+
+    return (*MPI_Pcontrol_target.get())(level);
+}
+
 //! Waiting requests
 DEFINE_FUNC2(
         Operation::C, Operation::Wait, Operation::Regular,
@@ -149,12 +246,39 @@ DEFINE_FUNC5(
         count_t, requests_t, flag_t, indices_t, statuses_t
 );
 
+//! Probing messages
+DEFINE_FUNC6(
+        Operation::C, Operation::Improbe, Operation::Regular,
+        int, MPI_Improbe,
+        rank_t, tag_t, comm_t, flag_t, message_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::Iprobe, Operation::Regular,
+        int, MPI_Iprobe,
+        rank_t, tag_t, comm_t, flag_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::Mprobe, Operation::Regular,
+        int, MPI_Mprobe,
+        rank_t, tag_t, comm_t, message_t, status_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::Probe, Operation::Regular,
+        int, MPI_Probe,
+        rank_t, tag_t, comm_t, status_t
+);
+
 //! Blocking primitives
 DEFINE_FUNC6(
         Operation::C, Operation::Bsend, Operation::Regular,
         int, MPI_Bsend,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t
 );
+DEFINE_FUNC5(
+        Operation::C, Operation::Mrecv, Operation::Regular,
+        int, MPI_Mrecv,
+        recvbuf_t, count_t, data_t, message_t, status_t
+);
 DEFINE_FUNC7(
         Operation::C, Operation::Recv, Operation::Regular,
         int, MPI_Recv,
@@ -285,6 +409,11 @@ DEFINE_FUNC7(
         int, MPI_Ibsend,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t
 );
+DEFINE_FUNC5(
+        Operation::C, Operation::Imrecv, Operation::Regular,
+        int, MPI_Imrecv,
+        recvbuf_t, count_t, data_t, message_t, request_t
+);
 DEFINE_FUNC7(
         Operation::C, Operation::Irecv, Operation::Regular,
         int, MPI_Irecv,
@@ -402,191 +531,918 @@ DEFINE_FUNC7(
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, request_t
 );
 
-//! The version MPI 4.0 introduces several new functions: large count flavors
-//! for all primitives and collectives, and the non-blocking sendrecv primitives
-#if MPI_VERSION >= 4
-
-//! Non-blocking sendrecv primitives
-DEFINE_FUNC12(
-        Operation::C, Operation::Isendrecv, Operation::Regular,
-        int, MPI_Isendrecv,
-        sendbuf_t, count_t, data_t, rank_t, tag_t, recvbuf_t, count_t, data_t,
-        rank_t, tag_t, comm_t, request_t
+//! Persistent primitives
+DEFINE_FUNC7(
+        Operation::C, Operation::BsendInit, Operation::Regular,
+        int, MPI_Bsend_init,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t
 );
-DEFINE_FUNC9(
-        Operation::C, Operation::IsendrecvReplace, Operation::Regular,
-        int, MPI_Isendrecv_replace,
-        recvbuf_t, count_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+DEFINE_FUNC7(
+        Operation::C, Operation::RecvInit, Operation::Regular,
+        int, MPI_Recv_init,
+        recvbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::RsendInit, Operation::Regular,
+        int, MPI_Rsend_init,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::SendInit, Operation::Regular,
+        int, MPI_Send_init,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::SsendInit, Operation::Regular,
+        int, MPI_Ssend_init,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+
+//! Starting persistent requests
+DEFINE_FUNC1(
+        Operation::C, Operation::Start, Operation::Regular,
+        int, MPI_Start,
         request_t
 );
+DEFINE_FUNC2(
+        Operation::C, Operation::Startall, Operation::Regular,
+        int, MPI_Startall,
+        count_t, requests_t
+);
 
-//! Blocking large primitives
+//! Creating and freeing RMA windows
 DEFINE_FUNC6(
-        Operation::C, Operation::Bsend, Operation::Large,
-        int, MPI_Bsend_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
-);
-DEFINE_FUNC7(
-        Operation::C, Operation::Recv, Operation::Large,
-        int, MPI_Recv_c,
-        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, status_t
+        Operation::C, Operation::WinAllocate, Operation::Regular,
+        int, MPI_Win_allocate,
+        aint_t, count_t, info_t, comm_t, baseptr_t, win_t
 );
 DEFINE_FUNC6(
-        Operation::C, Operation::Rsend, Operation::Large,
-        int, MPI_Rsend_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
+        Operation::C, Operation::WinAllocateShared, Operation::Regular,
+        int, MPI_Win_allocate_shared,
+        aint_t, count_t, info_t, comm_t, baseptr_t, win_t
 );
 DEFINE_FUNC6(
-        Operation::C, Operation::Send, Operation::Large,
-        int, MPI_Send_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
+        Operation::C, Operation::WinCreate, Operation::Regular,
+        int, MPI_Win_create,
+        recvbuf_t, aint_t, count_t, info_t, comm_t, win_t
 );
-DEFINE_FUNC12(
-        Operation::C, Operation::Sendrecv, Operation::Large,
-        int, MPI_Sendrecv_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, recvbuf_t, count_c_t,
-        data_t, rank_t, tag_t, comm_t, status_t
+DEFINE_FUNC3(
+        Operation::C, Operation::WinCreateDynamic, Operation::Regular,
+        int, MPI_Win_create_dynamic,
+        info_t, comm_t, win_t
+);
+DEFINE_FUNC1(
+        Operation::C, Operation::WinFree, Operation::Regular,
+        int, MPI_Win_free,
+        win_t
 );
+
+//! RMA communication
 DEFINE_FUNC9(
-        Operation::C, Operation::SendrecvReplace, Operation::Large,
-        int, MPI_Sendrecv_replace_c,
-        recvbuf_t, count_c_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
-        status_t
+        Operation::C, Operation::Accumulate, Operation::Regular,
+        int, MPI_Accumulate,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t, op_t,
+        win_handle_t
 );
-DEFINE_FUNC6(
-        Operation::C, Operation::Ssend, Operation::Large,
-        int, MPI_Ssend_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
+DEFINE_FUNC7(
+        Operation::C, Operation::CompareAndSwap, Operation::Regular,
+        int, MPI_Compare_and_swap,
+        sendbuf_t, sendbuf_t, recvbuf_t, data_t, rank_t, aint_t, win_handle_t
 );
-
-//! Blocking large collectives
 DEFINE_FUNC7(
-        Operation::C, Operation::Allgather, Operation::Large,
-        int, MPI_Allgather_c,
-        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t
+        Operation::C, Operation::FetchAndOp, Operation::Regular,
+        int, MPI_Fetch_and_op,
+        sendbuf_t, recvbuf_t, data_t, rank_t, aint_t, op_t, win_handle_t
 );
 DEFINE_FUNC8(
-        Operation::C, Operation::Allgatherv, Operation::Large,
-        int, MPI_Allgatherv_c,
-        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
-        comm_t
+        Operation::C, Operation::Get, Operation::Regular,
+        int, MPI_Get,
+        recvbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t
 );
-DEFINE_FUNC6(
-        Operation::C, Operation::Allreduce, Operation::Large,
-        int, MPI_Allreduce_c,
-        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+DEFINE_FUNC12(
+        Operation::C, Operation::GetAccumulate, Operation::Regular,
+        int, MPI_Get_accumulate,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, aint_t,
+        count_t, data_t, op_t, win_handle_t
 );
-DEFINE_FUNC7(
-        Operation::C, Operation::Alltoall, Operation::Large,
-        int, MPI_Alltoall_c,
-        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t
+DEFINE_FUNC8(
+        Operation::C, Operation::Put, Operation::Regular,
+        int, MPI_Put,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t
+);
+
+//! Request-based RMA communication
+DEFINE_FUNC10(
+        Operation::C, Operation::Raccumulate, Operation::Regular,
+        int, MPI_Raccumulate,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t, op_t,
+        win_handle_t, request_t
 );
 DEFINE_FUNC9(
-        Operation::C, Operation::Alltoallv, Operation::Large,
-        int, MPI_Alltoallv_c,
-        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
-        displs_c_t, data_t, comm_t
+        Operation::C, Operation::Rget, Operation::Regular,
+        int, MPI_Rget,
+        recvbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t, request_t
+);
+DEFINE_FUNC13(
+        Operation::C, Operation::RgetAccumulate, Operation::Regular,
+        int, MPI_Rget_accumulate,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, aint_t,
+        count_t, data_t, op_t, win_handle_t, request_t
 );
 DEFINE_FUNC9(
-        Operation::C, Operation::Alltoallw, Operation::Large,
-        int, MPI_Alltoallw_c,
-        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
-        displs_c_t, datas_t, comm_t
+        Operation::C, Operation::Rput, Operation::Regular,
+        int, MPI_Rput,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t, request_t
+);
+
+//! RMA active target synchronization
+DEFINE_FUNC2(
+        Operation::C, Operation::WinFence, Operation::Regular,
+        int, MPI_Win_fence,
+        assert_t, win_handle_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::WinPost, Operation::Regular,
+        int, MPI_Win_post,
+        group_t, assert_t, win_handle_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::WinStart, Operation::Regular,
+        int, MPI_Win_start,
+        group_t, assert_t, win_handle_t
 );
 DEFINE_FUNC1(
-        Operation::C, Operation::Barrier, Operation::Large,
-        int, MPI_Barrier_c,
-        comm_t
+        Operation::C, Operation::WinComplete, Operation::Regular,
+        int, MPI_Win_complete,
+        win_handle_t
+);
+DEFINE_FUNC1(
+        Operation::C, Operation::WinWait, Operation::Regular,
+        int, MPI_Win_wait,
+        win_handle_t
+);
+DEFINE_FUNC2(
+        Operation::C, Operation::WinTest, Operation::Regular,
+        int, MPI_Win_test,
+        win_handle_t, flag_t
+);
+
+//! RMA passive target synchronization
+DEFINE_FUNC4(
+        Operation::C, Operation::WinLock, Operation::Regular,
+        int, MPI_Win_lock,
+        lock_t, rank_t, assert_t, win_handle_t
+);
+DEFINE_FUNC2(
+        Operation::C, Operation::WinUnlock, Operation::Regular,
+        int, MPI_Win_unlock,
+        rank_t, win_handle_t
+);
+DEFINE_FUNC2(
+        Operation::C, Operation::WinLockAll, Operation::Regular,
+        int, MPI_Win_lock_all,
+        assert_t, win_handle_t
+);
+DEFINE_FUNC1(
+        Operation::C, Operation::WinUnlockAll, Operation::Regular,
+        int, MPI_Win_unlock_all,
+        win_handle_t
+);
+DEFINE_FUNC2(
+        Operation::C, Operation::WinFlush, Operation::Regular,
+        int, MPI_Win_flush,
+        rank_t, win_handle_t
+);
+DEFINE_FUNC1(
+        Operation::C, Operation::WinFlushAll, Operation::Regular,
+        int, MPI_Win_flush_all,
+        win_handle_t
+);
+DEFINE_FUNC2(
+        Operation::C, Operation::WinFlushLocal, Operation::Regular,
+        int, MPI_Win_flush_local,
+        rank_t, win_handle_t
+);
+DEFINE_FUNC1(
+        Operation::C, Operation::WinFlushLocalAll, Operation::Regular,
+        int, MPI_Win_flush_local_all,
+        win_handle_t
+);
+DEFINE_FUNC1(
+        Operation::C, Operation::WinSync, Operation::Regular,
+        int, MPI_Win_sync,
+        win_handle_t
 );
+
+//! Opening and managing files
 DEFINE_FUNC5(
-        Operation::C, Operation::Bcast, Operation::Large,
-        int, MPI_Bcast_c,
-        recvbuf_t, count_c_t, data_t, rank_t, comm_t
+        Operation::C, Operation::FileOpen, Operation::Regular,
+        int, MPI_File_open,
+        comm_t, string_t, amode_t, info_t, file_t
 );
-DEFINE_FUNC8(
-        Operation::C, Operation::Gather, Operation::Large,
-        int, MPI_Gather_c,
-        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
-        comm_t
+DEFINE_FUNC1(
+        Operation::C, Operation::FileClose, Operation::Regular,
+        int, MPI_File_close,
+        file_t
 );
-DEFINE_FUNC9(
-        Operation::C, Operation::Gatherv, Operation::Large,
-        int, MPI_Gatherv_c,
-        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
-        rank_t, comm_t
+DEFINE_FUNC6(
+        Operation::C, Operation::FileSetView, Operation::Regular,
+        int, MPI_File_set_view,
+        file_handle_t, offset_t, data_t, data_t, string_t, info_t
 );
-DEFINE_FUNC7(
-        Operation::C, Operation::Reduce, Operation::Large,
-        int, MPI_Reduce_c,
-        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, rank_t, comm_t
+DEFINE_FUNC1(
+        Operation::C, Operation::FileSync, Operation::Regular,
+        int, MPI_File_sync,
+        file_handle_t
+);
+
+//! Independent file accesses
+DEFINE_FUNC5(
+        Operation::C, Operation::FileRead, Operation::Regular,
+        int, MPI_File_read,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t
 );
 DEFINE_FUNC6(
-        Operation::C, Operation::ReduceScatter, Operation::Large,
-        int, MPI_Reduce_scatter_c,
-        sendbuf_t, recvbuf_t, counts_c_t, data_t, op_t, comm_t
+        Operation::C, Operation::FileReadAt, Operation::Regular,
+        int, MPI_File_read_at,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadShared, Operation::Regular,
+        int, MPI_File_read_shared,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWrite, Operation::Regular,
+        int, MPI_File_write,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t
 );
 DEFINE_FUNC6(
-        Operation::C, Operation::ReduceScatterBlock, Operation::Large,
-        int, MPI_Reduce_scatter_block_c,
-        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+        Operation::C, Operation::FileWriteAt, Operation::Regular,
+        int, MPI_File_write_at,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, status_t
 );
-DEFINE_FUNC8(
-        Operation::C, Operation::Scatter, Operation::Large,
-        int, MPI_Scatter_c,
-        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
-        comm_t
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteShared, Operation::Regular,
+        int, MPI_File_write_shared,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t
 );
-DEFINE_FUNC9(
-        Operation::C, Operation::Scatterv, Operation::Large,
-        int, MPI_Scatterv_c,
-        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, count_c_t, data_t,
-        rank_t, comm_t
+
+//! Collective file accesses
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadAll, Operation::Regular,
+        int, MPI_File_read_all,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t
 );
 DEFINE_FUNC6(
-        Operation::C, Operation::Scan, Operation::Large,
-        int, MPI_Scan_c,
-        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+        Operation::C, Operation::FileReadAtAll, Operation::Regular,
+        int, MPI_File_read_at_all,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadOrdered, Operation::Regular,
+        int, MPI_File_read_ordered,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteAll, Operation::Regular,
+        int, MPI_File_write_all,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t
 );
 DEFINE_FUNC6(
-        Operation::C, Operation::Exscan, Operation::Large,
-        int, MPI_Exscan_c,
-        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+        Operation::C, Operation::FileWriteAtAll, Operation::Regular,
+        int, MPI_File_write_at_all,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteOrdered, Operation::Regular,
+        int, MPI_File_write_ordered,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t
 );
 
-//! Non-blocking large primitives
-DEFINE_FUNC7(
-        Operation::C, Operation::Ibsend, Operation::Large,
-        int, MPI_Ibsend_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+//! Non-blocking file accesses
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIread, Operation::Regular,
+        int, MPI_File_iread,
+        file_handle_t, recvbuf_t, count_t, data_t, request_t
 );
-DEFINE_FUNC7(
-        Operation::C, Operation::Irecv, Operation::Large,
-        int, MPI_Irecv_c,
-        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIreadAt, Operation::Regular,
+        int, MPI_File_iread_at,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, request_t
 );
-DEFINE_FUNC7(
-        Operation::C, Operation::Irsend, Operation::Large,
-        int, MPI_Irsend_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIreadShared, Operation::Regular,
+        int, MPI_File_iread_shared,
+        file_handle_t, recvbuf_t, count_t, data_t, request_t
 );
-DEFINE_FUNC7(
-        Operation::C, Operation::Isend, Operation::Large,
-        int, MPI_Isend_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIwrite, Operation::Regular,
+        int, MPI_File_iwrite,
+        file_handle_t, sendbuf_t, count_t, data_t, request_t
 );
-DEFINE_FUNC12(
-        Operation::C, Operation::Isendrecv, Operation::Large,
-        int, MPI_Isendrecv_c,
-        sendbuf_t, count_c_t, data_t, rank_t, tag_t, recvbuf_t, count_c_t,
-        data_t, rank_t, tag_t, comm_t, request_t
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIwriteAt, Operation::Regular,
+        int, MPI_File_iwrite_at,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, request_t
 );
-DEFINE_FUNC9(
-        Operation::C, Operation::IsendrecvReplace, Operation::Large,
-        int, MPI_Isendrecv_replace_c,
-        recvbuf_t, count_c_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
-        request_t
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIwriteShared, Operation::Regular,
+        int, MPI_File_iwrite_shared,
+        file_handle_t, sendbuf_t, count_t, data_t, request_t
 );
-DEFINE_FUNC7(
+
+//! The version MPI 3.1 introduces the non-blocking collective file accesses
+#if MPI_VERSION > 3 || (MPI_VERSION == 3 && MPI_SUBVERSION >= 1)
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIreadAll, Operation::Regular,
+        int, MPI_File_iread_all,
+        file_handle_t, recvbuf_t, count_t, data_t, request_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIreadAtAll, Operation::Regular,
+        int, MPI_File_iread_at_all,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, request_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIwriteAll, Operation::Regular,
+        int, MPI_File_iwrite_all,
+        file_handle_t, sendbuf_t, count_t, data_t, request_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIwriteAtAll, Operation::Regular,
+        int, MPI_File_iwrite_at_all,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, request_t
+);
+#endif
+
+//! Split collective file accesses
+DEFINE_FUNC4(
+        Operation::C, Operation::FileReadAllBegin, Operation::Regular,
+        int, MPI_File_read_all_begin,
+        file_handle_t, recvbuf_t, count_t, data_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::FileReadAllEnd, Operation::Regular,
+        int, MPI_File_read_all_end,
+        file_handle_t, recvbuf_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadAtAllBegin, Operation::Regular,
+        int, MPI_File_read_at_all_begin,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::FileReadAtAllEnd, Operation::Regular,
+        int, MPI_File_read_at_all_end,
+        file_handle_t, recvbuf_t, status_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::FileReadOrderedBegin, Operation::Regular,
+        int, MPI_File_read_ordered_begin,
+        file_handle_t, recvbuf_t, count_t, data_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::FileReadOrderedEnd, Operation::Regular,
+        int, MPI_File_read_ordered_end,
+        file_handle_t, recvbuf_t, status_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::FileWriteAllBegin, Operation::Regular,
+        int, MPI_File_write_all_begin,
+        file_handle_t, sendbuf_t, count_t, data_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::FileWriteAllEnd, Operation::Regular,
+        int, MPI_File_write_all_end,
+        file_handle_t, sendbuf_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteAtAllBegin, Operation::Regular,
+        int, MPI_File_write_at_all_begin,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::FileWriteAtAllEnd, Operation::Regular,
+        int, MPI_File_write_at_all_end,
+        file_handle_t, sendbuf_t, status_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::FileWriteOrderedBegin, Operation::Regular,
+        int, MPI_File_write_ordered_begin,
+        file_handle_t, sendbuf_t, count_t, data_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::FileWriteOrderedEnd, Operation::Regular,
+        int, MPI_File_write_ordered_end,
+        file_handle_t, sendbuf_t, status_t
+);
+
+//! Neighborhood collectives
+DEFINE_FUNC7(
+        Operation::C, Operation::NeighborAllgather, Operation::Regular,
+        int, MPI_Neighbor_allgather,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::NeighborAllgatherv, Operation::Regular,
+        int, MPI_Neighbor_allgatherv,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::NeighborAlltoall, Operation::Regular,
+        int, MPI_Neighbor_alltoall,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAlltoallv, Operation::Regular,
+        int, MPI_Neighbor_alltoallv,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAlltoallw, Operation::Regular,
+        int, MPI_Neighbor_alltoallw,
+        sendbuf_t, counts_t, displs_c_t, datas_t, recvbuf_t, counts_t,
+        displs_c_t, datas_t, comm_t
+);
+
+//! Non-blocking neighborhood collectives
+DEFINE_FUNC8(
+        Operation::C, Operation::IneighborAllgather, Operation::Regular,
+        int, MPI_Ineighbor_allgather,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t,
+        request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::IneighborAllgatherv, Operation::Regular,
+        int, MPI_Ineighbor_allgatherv,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::IneighborAlltoall, Operation::Regular,
+        int, MPI_Ineighbor_alltoall,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t,
+        request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::IneighborAlltoallv, Operation::Regular,
+        int, MPI_Ineighbor_alltoallv,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::IneighborAlltoallw, Operation::Regular,
+        int, MPI_Ineighbor_alltoallw,
+        sendbuf_t, counts_t, displs_c_t, datas_t, recvbuf_t, counts_t,
+        displs_c_t, datas_t, comm_t, request_t
+);
+
+//! Creating topology communicators
+DEFINE_FUNC6(
+        Operation::C, Operation::CartCreate, Operation::Regular,
+        int, MPI_Cart_create,
+        comm_t, count_t, ints_t, ints_t, reorder_t, newcomm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::GraphCreate, Operation::Regular,
+        int, MPI_Graph_create,
+        comm_t, count_t, ints_t, ints_t, reorder_t, newcomm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::DistGraphCreate, Operation::Regular,
+        int, MPI_Dist_graph_create,
+        comm_t, count_t, ints_t, ints_t, ints_t, ints_t, info_t, reorder_t,
+        newcomm_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::DistGraphCreateAdjacent, Operation::Regular,
+        int, MPI_Dist_graph_create_adjacent,
+        comm_t, count_t, ints_t, ints_t, count_t, ints_t, ints_t, info_t,
+        reorder_t, newcomm_t
+);
+
+//! Creating communicators
+DEFINE_FUNC2(
+        Operation::C, Operation::CommDup, Operation::Regular,
+        int, MPI_Comm_dup,
+        comm_t, newcomm_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::CommSplit, Operation::Regular,
+        int, MPI_Comm_split,
+        comm_t, color_t, splitkey_t, newcomm_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::CommSplitType, Operation::Regular,
+        int, MPI_Comm_split_type,
+        comm_t, color_t, splitkey_t, info_t, newcomm_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::CommCreate, Operation::Regular,
+        int, MPI_Comm_create,
+        comm_t, group_t, newcomm_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::CommCreateGroup, Operation::Regular,
+        int, MPI_Comm_create_group,
+        comm_t, group_t, tag_t, newcomm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::IntercommCreate, Operation::Regular,
+        int, MPI_Intercomm_create,
+        comm_t, rank_t, comm_t, rank_t, tag_t, newcomm_t
+);
+
+
+//! The version MPI 4.0 introduces several new functions: large count flavors
+//! for all primitives, collectives, RMA operations and file accesses, the
+//! non-blocking sendrecv primitives, the partitioned primitives and the
+//! persistent collectives
+#if MPI_VERSION >= 4
+
+//! Non-blocking sendrecv primitives
+DEFINE_FUNC12(
+        Operation::C, Operation::Isendrecv, Operation::Regular,
+        int, MPI_Isendrecv,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, recvbuf_t, count_t, data_t,
+        rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::IsendrecvReplace, Operation::Regular,
+        int, MPI_Isendrecv_replace,
+        recvbuf_t, count_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+        request_t
+);
+
+//! Partitioned primitives
+DEFINE_FUNC3(
+        Operation::C, Operation::Parrived, Operation::Regular,
+        int, MPI_Parrived,
+        request_handle_t, partition_t, flag_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::PrecvInit, Operation::Regular,
+        int, MPI_Precv_init,
+        recvbuf_t, partition_t, count_c_t, data_t, rank_t, tag_t, comm_t,
+        info_t, request_t
+);
+DEFINE_FUNC2(
+        Operation::C, Operation::Pready, Operation::Regular,
+        int, MPI_Pready,
+        partition_t, request_handle_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::PreadyList, Operation::Regular,
+        int, MPI_Pready_list,
+        count_t, partitions_t, request_handle_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::PreadyRange, Operation::Regular,
+        int, MPI_Pready_range,
+        partition_t, partition_t, request_handle_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::PsendInit, Operation::Regular,
+        int, MPI_Psend_init,
+        sendbuf_t, partition_t, count_c_t, data_t, rank_t, tag_t, comm_t,
+        info_t, request_t
+);
+
+//! Persistent collectives
+DEFINE_FUNC9(
+        Operation::C, Operation::AllgatherInit, Operation::Regular,
+        int, MPI_Allgather_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::AllgathervInit, Operation::Regular,
+        int, MPI_Allgatherv_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t, info_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::AllreduceInit, Operation::Regular,
+        int, MPI_Allreduce_init,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::AlltoallInit, Operation::Regular,
+        int, MPI_Alltoall_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::AlltoallvInit, Operation::Regular,
+        int, MPI_Alltoallv_init,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::AlltoallwInit, Operation::Regular,
+        int, MPI_Alltoallw_init,
+        sendbuf_t, counts_t, displs_t, datas_t, recvbuf_t, counts_t, displs_t,
+        datas_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC3(
+        Operation::C, Operation::BarrierInit, Operation::Regular,
+        int, MPI_Barrier_init,
+        comm_t, info_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::BcastInit, Operation::Regular,
+        int, MPI_Bcast_init,
+        recvbuf_t, count_t, data_t, rank_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::GatherInit, Operation::Regular,
+        int, MPI_Gather_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
+        info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::GathervInit, Operation::Regular,
+        int, MPI_Gatherv_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        rank_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::ReduceInit, Operation::Regular,
+        int, MPI_Reduce_init,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, rank_t, comm_t, info_t,
+        request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ReduceScatterInit, Operation::Regular,
+        int, MPI_Reduce_scatter_init,
+        sendbuf_t, recvbuf_t, counts_t, data_t, op_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ReduceScatterBlockInit, Operation::Regular,
+        int, MPI_Reduce_scatter_block_init,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::ScatterInit, Operation::Regular,
+        int, MPI_Scatter_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
+        info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::ScattervInit, Operation::Regular,
+        int, MPI_Scatterv_init,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, count_t, data_t,
+        rank_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ScanInit, Operation::Regular,
+        int, MPI_Scan_init,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ExscanInit, Operation::Regular,
+        int, MPI_Exscan_init,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t
+);
+
+//! Persistent neighborhood collectives
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAllgatherInit, Operation::Regular,
+        int, MPI_Neighbor_allgather_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::NeighborAllgathervInit, Operation::Regular,
+        int, MPI_Neighbor_allgatherv_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t, info_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAlltoallInit, Operation::Regular,
+        int, MPI_Neighbor_alltoall_init,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::NeighborAlltoallvInit, Operation::Regular,
+        int, MPI_Neighbor_alltoallv_init,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::NeighborAlltoallwInit, Operation::Regular,
+        int, MPI_Neighbor_alltoallw_init,
+        sendbuf_t, counts_t, displs_c_t, datas_t, recvbuf_t, counts_t,
+        displs_c_t, datas_t, comm_t, info_t, request_t
+);
+
+//! Blocking large primitives
+DEFINE_FUNC6(
+        Operation::C, Operation::Bsend, Operation::Large,
+        int, MPI_Bsend_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::Mrecv, Operation::Large,
+        int, MPI_Mrecv_c,
+        recvbuf_t, count_c_t, data_t, message_t, status_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::Recv, Operation::Large,
+        int, MPI_Recv_c,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, status_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::Rsend, Operation::Large,
+        int, MPI_Rsend_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::Send, Operation::Large,
+        int, MPI_Send_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
+);
+DEFINE_FUNC12(
+        Operation::C, Operation::Sendrecv, Operation::Large,
+        int, MPI_Sendrecv_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, recvbuf_t, count_c_t,
+        data_t, rank_t, tag_t, comm_t, status_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::SendrecvReplace, Operation::Large,
+        int, MPI_Sendrecv_replace_c,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+        status_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::Ssend, Operation::Large,
+        int, MPI_Ssend_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t
+);
+
+//! Persistent large primitives
+DEFINE_FUNC7(
+        Operation::C, Operation::BsendInit, Operation::Large,
+        int, MPI_Bsend_init_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::RecvInit, Operation::Large,
+        int, MPI_Recv_init_c,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::RsendInit, Operation::Large,
+        int, MPI_Rsend_init_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::SendInit, Operation::Large,
+        int, MPI_Send_init_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::SsendInit, Operation::Large,
+        int, MPI_Ssend_init_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+
+//! Blocking large collectives
+DEFINE_FUNC7(
+        Operation::C, Operation::Allgather, Operation::Large,
+        int, MPI_Allgather_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::Allgatherv, Operation::Large,
+        int, MPI_Allgatherv_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::Allreduce, Operation::Large,
+        int, MPI_Allreduce_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::Alltoall, Operation::Large,
+        int, MPI_Alltoall_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::Alltoallv, Operation::Large,
+        int, MPI_Alltoallv_c,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::Alltoallw, Operation::Large,
+        int, MPI_Alltoallw_c,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::Bcast, Operation::Large,
+        int, MPI_Bcast_c,
+        recvbuf_t, count_c_t, data_t, rank_t, comm_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::Gather, Operation::Large,
+        int, MPI_Gather_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::Gatherv, Operation::Large,
+        int, MPI_Gatherv_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        rank_t, comm_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::Reduce, Operation::Large,
+        int, MPI_Reduce_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, rank_t, comm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::ReduceScatter, Operation::Large,
+        int, MPI_Reduce_scatter_c,
+        sendbuf_t, recvbuf_t, counts_c_t, data_t, op_t, comm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::ReduceScatterBlock, Operation::Large,
+        int, MPI_Reduce_scatter_block_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::Scatter, Operation::Large,
+        int, MPI_Scatter_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::Scatterv, Operation::Large,
+        int, MPI_Scatterv_c,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, count_c_t, data_t,
+        rank_t, comm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::Scan, Operation::Large,
+        int, MPI_Scan_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::Exscan, Operation::Large,
+        int, MPI_Exscan_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t
+);
+
+//! Non-blocking large primitives
+DEFINE_FUNC7(
+        Operation::C, Operation::Ibsend, Operation::Large,
+        int, MPI_Ibsend_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::Imrecv, Operation::Large,
+        int, MPI_Imrecv_c,
+        recvbuf_t, count_c_t, data_t, message_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::Irecv, Operation::Large,
+        int, MPI_Irecv_c,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::Irsend, Operation::Large,
+        int, MPI_Irsend_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::Isend, Operation::Large,
+        int, MPI_Isend_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC12(
+        Operation::C, Operation::Isendrecv, Operation::Large,
+        int, MPI_Isendrecv_c,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, recvbuf_t, count_c_t,
+        data_t, rank_t, tag_t, comm_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::IsendrecvReplace, Operation::Large,
+        int, MPI_Isendrecv_replace_c,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+        request_t
+);
+DEFINE_FUNC7(
         Operation::C, Operation::Issend, Operation::Large,
         int, MPI_Issend_c,
         sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t
@@ -628,11 +1484,6 @@ DEFINE_FUNC10(
         sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
         displs_c_t, datas_t, comm_t, request_t
 );
-DEFINE_FUNC2(
-        Operation::C, Operation::Ibarrier, Operation::Large,
-        int, MPI_Ibarrier_c,
-        comm_t, request_t
-);
 DEFINE_FUNC6(
         Operation::C, Operation::Ibcast, Operation::Large,
         int, MPI_Ibcast_c,
@@ -688,6 +1539,414 @@ DEFINE_FUNC7(
         sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, request_t
 );
 
+//! Persistent large collectives
+DEFINE_FUNC9(
+        Operation::C, Operation::AllgatherInit, Operation::Large,
+        int, MPI_Allgather_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::AllgathervInit, Operation::Large,
+        int, MPI_Allgatherv_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, info_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::AllreduceInit, Operation::Large,
+        int, MPI_Allreduce_init_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::AlltoallInit, Operation::Large,
+        int, MPI_Alltoall_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::AlltoallvInit, Operation::Large,
+        int, MPI_Alltoallv_init_c,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::AlltoallwInit, Operation::Large,
+        int, MPI_Alltoallw_init_c,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::BcastInit, Operation::Large,
+        int, MPI_Bcast_init_c,
+        recvbuf_t, count_c_t, data_t, rank_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::GatherInit, Operation::Large,
+        int, MPI_Gather_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::GathervInit, Operation::Large,
+        int, MPI_Gatherv_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        rank_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::ReduceInit, Operation::Large,
+        int, MPI_Reduce_init_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, rank_t, comm_t, info_t,
+        request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ReduceScatterInit, Operation::Large,
+        int, MPI_Reduce_scatter_init_c,
+        sendbuf_t, recvbuf_t, counts_c_t, data_t, op_t, comm_t, info_t,
+        request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ReduceScatterBlockInit, Operation::Large,
+        int, MPI_Reduce_scatter_block_init_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::ScatterInit, Operation::Large,
+        int, MPI_Scatter_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::ScattervInit, Operation::Large,
+        int, MPI_Scatterv_init_c,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, count_c_t, data_t,
+        rank_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ScanInit, Operation::Large,
+        int, MPI_Scan_init_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::ExscanInit, Operation::Large,
+        int, MPI_Exscan_init_c,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t, request_t
+);
+
+
+//! Creating large RMA windows
+DEFINE_FUNC6(
+        Operation::C, Operation::WinAllocate, Operation::Large,
+        int, MPI_Win_allocate_c,
+        aint_t, aint_t, info_t, comm_t, baseptr_t, win_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::WinAllocateShared, Operation::Large,
+        int, MPI_Win_allocate_shared_c,
+        aint_t, aint_t, info_t, comm_t, baseptr_t, win_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::WinCreate, Operation::Large,
+        int, MPI_Win_create_c,
+        recvbuf_t, aint_t, aint_t, info_t, comm_t, win_t
+);
+
+//! Large RMA communication
+DEFINE_FUNC9(
+        Operation::C, Operation::Accumulate, Operation::Large,
+        int, MPI_Accumulate_c,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t, op_t,
+        win_handle_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::Get, Operation::Large,
+        int, MPI_Get_c,
+        recvbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t
+);
+DEFINE_FUNC12(
+        Operation::C, Operation::GetAccumulate, Operation::Large,
+        int, MPI_Get_accumulate_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        aint_t, count_c_t, data_t, op_t, win_handle_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::Put, Operation::Large,
+        int, MPI_Put_c,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t
+);
+
+//! Request-based large RMA communication
+DEFINE_FUNC10(
+        Operation::C, Operation::Raccumulate, Operation::Large,
+        int, MPI_Raccumulate_c,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t, op_t,
+        win_handle_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::Rget, Operation::Large,
+        int, MPI_Rget_c,
+        recvbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t, request_t
+);
+DEFINE_FUNC13(
+        Operation::C, Operation::RgetAccumulate, Operation::Large,
+        int, MPI_Rget_accumulate_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        aint_t, count_c_t, data_t, op_t, win_handle_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::Rput, Operation::Large,
+        int, MPI_Rput_c,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t, request_t
+);
+
+
+//! Independent large file accesses
+DEFINE_FUNC5(
+        Operation::C, Operation::FileRead, Operation::Large,
+        int, MPI_File_read_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileReadAt, Operation::Large,
+        int, MPI_File_read_at_c,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadShared, Operation::Large,
+        int, MPI_File_read_shared_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWrite, Operation::Large,
+        int, MPI_File_write_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileWriteAt, Operation::Large,
+        int, MPI_File_write_at_c,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteShared, Operation::Large,
+        int, MPI_File_write_shared_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t
+);
+
+//! Collective large file accesses
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadAll, Operation::Large,
+        int, MPI_File_read_all_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileReadAtAll, Operation::Large,
+        int, MPI_File_read_at_all_c,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadOrdered, Operation::Large,
+        int, MPI_File_read_ordered_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteAll, Operation::Large,
+        int, MPI_File_write_all_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileWriteAtAll, Operation::Large,
+        int, MPI_File_write_at_all_c,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, status_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteOrdered, Operation::Large,
+        int, MPI_File_write_ordered_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t
+);
+
+//! Non-blocking large file accesses
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIread, Operation::Large,
+        int, MPI_File_iread_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIreadAt, Operation::Large,
+        int, MPI_File_iread_at_c,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIreadShared, Operation::Large,
+        int, MPI_File_iread_shared_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIwrite, Operation::Large,
+        int, MPI_File_iwrite_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIwriteAt, Operation::Large,
+        int, MPI_File_iwrite_at_c,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIwriteShared, Operation::Large,
+        int, MPI_File_iwrite_shared_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t, request_t
+);
+
+//! Non-blocking large collective file accesses
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIreadAll, Operation::Large,
+        int, MPI_File_iread_all_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIreadAtAll, Operation::Large,
+        int, MPI_File_iread_at_all_c,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileIwriteAll, Operation::Large,
+        int, MPI_File_iwrite_all_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t, request_t
+);
+DEFINE_FUNC6(
+        Operation::C, Operation::FileIwriteAtAll, Operation::Large,
+        int, MPI_File_iwrite_at_all_c,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, request_t
+);
+
+//! Split collective large file accesses
+DEFINE_FUNC4(
+        Operation::C, Operation::FileReadAllBegin, Operation::Large,
+        int, MPI_File_read_all_begin_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileReadAtAllBegin, Operation::Large,
+        int, MPI_File_read_at_all_begin_c,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::FileReadOrderedBegin, Operation::Large,
+        int, MPI_File_read_ordered_begin_c,
+        file_handle_t, recvbuf_t, count_c_t, data_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::FileWriteAllBegin, Operation::Large,
+        int, MPI_File_write_all_begin_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t
+);
+DEFINE_FUNC5(
+        Operation::C, Operation::FileWriteAtAllBegin, Operation::Large,
+        int, MPI_File_write_at_all_begin_c,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t
+);
+DEFINE_FUNC4(
+        Operation::C, Operation::FileWriteOrderedBegin, Operation::Large,
+        int, MPI_File_write_ordered_begin_c,
+        file_handle_t, sendbuf_t, count_c_t, data_t
+);
+
+//! Blocking large neighborhood collectives
+DEFINE_FUNC7(
+        Operation::C, Operation::NeighborAllgather, Operation::Large,
+        int, MPI_Neighbor_allgather_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::NeighborAllgatherv, Operation::Large,
+        int, MPI_Neighbor_allgatherv_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t
+);
+DEFINE_FUNC7(
+        Operation::C, Operation::NeighborAlltoall, Operation::Large,
+        int, MPI_Neighbor_alltoall_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAlltoallv, Operation::Large,
+        int, MPI_Neighbor_alltoallv_c,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAlltoallw, Operation::Large,
+        int, MPI_Neighbor_alltoallw_c,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t
+);
+
+//! Non-blocking large neighborhood collectives
+DEFINE_FUNC8(
+        Operation::C, Operation::IneighborAllgather, Operation::Large,
+        int, MPI_Ineighbor_allgather_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::IneighborAllgatherv, Operation::Large,
+        int, MPI_Ineighbor_allgatherv_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, request_t
+);
+DEFINE_FUNC8(
+        Operation::C, Operation::IneighborAlltoall, Operation::Large,
+        int, MPI_Ineighbor_alltoall_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::IneighborAlltoallv, Operation::Large,
+        int, MPI_Ineighbor_alltoallv_c,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::IneighborAlltoallw, Operation::Large,
+        int, MPI_Ineighbor_alltoallw_c,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, request_t
+);
+
+//! Persistent large neighborhood collectives
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAllgatherInit, Operation::Large,
+        int, MPI_Neighbor_allgather_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t
+);
+DEFINE_FUNC10(
+        Operation::C, Operation::NeighborAllgathervInit, Operation::Large,
+        int, MPI_Neighbor_allgatherv_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, info_t, request_t
+);
+DEFINE_FUNC9(
+        Operation::C, Operation::NeighborAlltoallInit, Operation::Large,
+        int, MPI_Neighbor_alltoall_init_c,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::NeighborAlltoallvInit, Operation::Large,
+        int, MPI_Neighbor_alltoallv_init_c,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, info_t, request_t
+);
+DEFINE_FUNC11(
+        Operation::C, Operation::NeighborAlltoallwInit, Operation::Large,
+        int, MPI_Neighbor_alltoallw_init_c,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, info_t, request_t
+);
+
 #endif
 
 } // extern C
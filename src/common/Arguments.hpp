@@ -0,0 +1,987 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef ARGUMENTS_HPP
+#define ARGUMENTS_HPP
+
+#include <cstdint>
+#include <mpi.h>
+#include <tuple>
+#include <type_traits>
+
+#include "Datatype.hpp"
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that converts the argument values of the C and Fortran interfaces
+//! to C values. The C and Fortran interfaces pass the arguments in the same
+//! positions, but Fortran passes all of them by reference as Fortran handles
+class Convert {
+public:
+    static MPI_Count count(int count) { return count; }
+    static MPI_Count count(MPI_Count count) { return count; }
+    static MPI_Count count(MPI_Fint *count) { return *count; }
+    static MPI_Count count(MPI_Count *count) { return *count; }
+
+    static MPI_Offset offset(MPI_Offset offset) { return offset; }
+    static MPI_Offset offset(MPI_Offset *offset) { return *offset; }
+
+    static int32_t integer(int value) { return value; }
+    static int32_t integer(MPI_Fint *value) { return *value; }
+
+    static MPI_Datatype datatype(MPI_Datatype type) { return type; }
+    static MPI_Datatype datatype(MPI_Fint *type) { return MPI_Type_f2c(*type); }
+
+    //! The communicator identifier is its Fortran handle, which is an integer
+    //! in all MPI implementations
+    static int32_t comm(MPI_Comm comm) { return MPI_Comm_c2f(comm); }
+    static int32_t comm(MPI_Fint *comm) { return *comm; }
+
+    //! \brief Get the C status or null if the status is ignored
+    static const MPI_Status *status(MPI_Status *status, MPI_Status &)
+    {
+        return (status != MPI_STATUS_IGNORE) ? status : nullptr;
+    }
+
+    //! \brief Get the C status or null if the status is ignored
+    static const MPI_Status *status(MPI_Fint *status, MPI_Status &storage)
+    {
+        if (status == MPI_F_STATUS_IGNORE)
+            return nullptr;
+        if (MPI_Status_f2c(status, &storage) != MPI_SUCCESS)
+            return nullptr;
+        return &storage;
+    }
+
+#if MPI_VERSION >= 4
+    //! \brief Get the C status of an mpi_f08 status or null if the status is
+    //! ignored
+    static const MPI_Status *status(MPI_F08_status *status, MPI_Status &storage)
+    {
+        if (status == MPI_F08_STATUS_IGNORE)
+            return nullptr;
+        if (MPI_Status_f082c(status, &storage) != MPI_SUCCESS)
+            return nullptr;
+        return &storage;
+    }
+#endif
+
+    //! \brief Get the C handle of a request in an array of requests
+    //!
+    //! The language is explicit because the C request and Fortran handle
+    //! types may be the same
+    template <Operation::Lang Lang, typename RequestsTy>
+    static MPI_Request request(RequestsTy requests, int index)
+    {
+        if constexpr (Lang == Operation::Fortran)
+            return MPI_Request_f2c(requests[index]);
+        else
+            return requests[index];
+    }
+
+    //! \brief Get the C handle of a datatype in an array of datatypes
+    //!
+    //! The language is explicit because the C datatype and Fortran handle
+    //! types may be the same
+    template <Operation::Lang Lang, typename TypesTy>
+    static MPI_Datatype datatype(TypesTy types, int index)
+    {
+        if constexpr (Lang == Operation::Fortran)
+            return MPI_Type_f2c(types[index]);
+        else
+            return types[index];
+    }
+
+    //! \brief Get the C handle of a communicator from a pointer to it
+    //!
+    //! The language is explicit because the C communicator and Fortran handle
+    //! types may be the same
+    template <Operation::Lang Lang, typename CommTy>
+    static MPI_Comm handle(CommTy comm)
+    {
+        if constexpr (Lang == Operation::Fortran)
+            return MPI_Comm_f2c(*comm);
+        else
+            return *comm;
+    }
+
+    //! \brief Get the C handle of a window or a pointer to a window
+    //!
+    //! The language is explicit because the C window and Fortran handle types
+    //! may be the same
+    template <Operation::Lang Lang, typename WindowTy>
+    static MPI_Win window(WindowTy window)
+    {
+        if constexpr (Lang == Operation::Fortran)
+            return MPI_Win_f2c(*window);
+        else if constexpr (std::is_same_v<WindowTy, MPI_Win *>)
+            return *window;
+        else
+            return window;
+    }
+
+    //! \brief Get the C handle of a file or a pointer to a file
+    //!
+    //! The language is explicit because the C file and Fortran handle types
+    //! may be the same
+    template <Operation::Lang Lang, typename FileTy>
+    static MPI_File file(FileTy file)
+    {
+        if constexpr (Lang == Operation::Fortran)
+            return MPI_File_f2c(*file);
+        else if constexpr (std::is_same_v<FileTy, MPI_File *>)
+            return *file;
+        else
+            return file;
+    }
+
+    //! \brief Get a zero-based index of an array of indices
+    //!
+    //! Fortran indices are one-based. Undefined indices are kept as they are
+    template <Operation::Lang Lang, typename IndicesTy>
+    static int index(IndicesTy indices, int position)
+    {
+        int value = indices[position];
+        if (Lang == Operation::Fortran && value != MPI_UNDEFINED)
+            return value - 1;
+        return value;
+    }
+};
+
+//! Class describing an operation without relevant arguments
+struct NoArguments {
+    //! Whether the operation sends a message
+    static constexpr bool Sends = false;
+
+    //! Whether the operation receives a message
+    static constexpr bool Receives = false;
+
+    //! Whether the operation tests the completion of requests
+    static constexpr bool Polls = false;
+
+    //! Whether the operation waits or tests the completion of requests
+    static constexpr bool Completes = false;
+
+    //! Whether the operation is a blocking collective
+    static constexpr bool Collective = false;
+
+    //! Whether the operation initializes a persistent send
+    static constexpr bool PersistentSends = false;
+
+    //! Whether the operation starts persistent requests
+    static constexpr bool Starts = false;
+
+    //! Whether the operation creates an RMA window
+    static constexpr bool CreatesWindow = false;
+
+    //! Whether the operation frees an RMA window
+    static constexpr bool FreesWindow = false;
+
+    //! Whether the operation accesses the memory of an RMA window
+    static constexpr bool Accesses = false;
+
+    //! Whether the operation synchronizes an RMA window
+    static constexpr bool Synchronizes = false;
+
+    //! Whether the operation opens a file
+    static constexpr bool OpensFile = false;
+
+    //! Whether the operation closes a file
+    static constexpr bool ClosesFile = false;
+
+    //! Whether the operation reads or writes a file
+    static constexpr bool AccessesFile = false;
+
+    //! Whether the operation is a neighborhood collective
+    static constexpr bool Neighborhood = false;
+
+    //! Whether the operation creates a communicator
+    static constexpr bool CreatesComm = false;
+
+    //! Whether the operation creates a topology communicator
+    static constexpr bool CreatesTopology = false;
+};
+
+//! Information of a point-to-point message
+struct Message {
+    int32_t _peer;
+    int32_t _tag;
+    uint64_t _bytes;
+    int32_t _comm;
+};
+
+//! \brief Update a message with the actual source, tag and size of a status
+static inline void readStatus(const MPI_Status *status, Message &message)
+{
+    MPI_Count bytes;
+    message._peer = status->MPI_SOURCE;
+    message._tag = status->MPI_TAG;
+    if (PMPI_Get_elements_x(status, MPI_BYTE, &bytes) == MPI_SUCCESS
+            && bytes != MPI_UNDEFINED)
+        message._bytes = bytes;
+}
+
+//! Class describing the position of the message arguments of point-to-point
+//! operations. A negative position means the operation has no such argument
+template <int SendCount, int SendType, int Dest, int SendTag,
+          int RecvCount, int RecvType, int Source, int RecvTag,
+          int Comm, int Status>
+struct MessageArguments : NoArguments {
+    //! Whether the operation sends a message
+    static constexpr bool Sends = (SendCount >= 0);
+
+    //! Whether the operation receives a message
+    static constexpr bool Receives = (RecvCount >= 0);
+
+    //! \brief Check whether the operation received the message
+    template <typename... Params>
+    static bool matched(Params ...)
+    {
+        return true;
+    }
+
+    //! \brief Get the information of the sent message
+    template <typename... Params>
+    static Message sent(Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        MPI_Count count = Convert::count(std::get<SendCount>(args));
+        MPI_Datatype type = Convert::datatype(std::get<SendType>(args));
+
+        return {
+            Convert::integer(std::get<Dest>(args)),
+            Convert::integer(std::get<SendTag>(args)),
+            Datatype::bytes(count, type),
+            Convert::comm(std::get<Comm>(args))
+        };
+    }
+
+    //! \brief Get the information of the received message
+    //!
+    //! The actual source, tag and size are taken from the status when the
+    //! operation completed and the status was not ignored. Otherwise, the
+    //! posted values are reported
+    template <typename... Params>
+    static Message received(Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        MPI_Count count = Convert::count(std::get<RecvCount>(args));
+        MPI_Datatype type = Convert::datatype(std::get<RecvType>(args));
+
+        Message message = {
+            Convert::integer(std::get<Source>(args)),
+            Convert::integer(std::get<RecvTag>(args)),
+            Datatype::bytes(count, type),
+            Convert::comm(std::get<Comm>(args))
+        };
+
+        if constexpr (Status >= 0) {
+            MPI_Status storage;
+            const MPI_Status *status = Convert::status(std::get<Status>(args), storage);
+            if (status != nullptr)
+                readStatus(status, message);
+        }
+        return message;
+    }
+};
+
+//! Class describing the position of the flag argument of the operations that
+//! poll for an event other than the completion of requests. A negative
+//! position means the operation does not poll
+template <int Flag>
+struct PollArguments : NoArguments {
+    static constexpr bool Polls = (Flag >= 0);
+
+    //! \brief Check whether the polled event happened
+    template <typename... Params>
+    static bool succeeded(Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        return Convert::integer(std::get<Flag>(args)) != 0;
+    }
+};
+
+//! Class describing the position of the arguments of probe operations:
+//! (source, tag, comm, ...). A negative position means the operation has no
+//! such argument. The matched probes remove the message from the matching
+//! queue, so they report it as received when they find it. The message is
+//! reported with the posted source and tag and no size if the status is
+//! ignored
+template <bool Matched, int Flag, int Status>
+struct ProbeArguments : PollArguments<Flag> {
+    static constexpr bool Receives = Matched;
+
+    //! \brief Check whether the probe matched a message
+    template <typename... Params>
+    static bool matched(Params ...params)
+    {
+        if constexpr (Flag >= 0)
+            return PollArguments<Flag>::succeeded(params...);
+        return true;
+    }
+
+    //! \brief Get the information of the matched message
+    template <typename... Params>
+    static Message received(Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        Message message = {
+            Convert::integer(std::get<0>(args)),
+            Convert::integer(std::get<1>(args)),
+            0,
+            Convert::comm(std::get<2>(args))
+        };
+
+        MPI_Status storage;
+        const MPI_Status *status = Convert::status(std::get<Status>(args), storage);
+        if (status != nullptr)
+            readStatus(status, message);
+        return message;
+    }
+};
+
+//! Class describing the position of the arguments of wait and test
+//! operations. A negative position means the operation has no such argument.
+//! Operations without count take a single request, operations with an index
+//! complete at most one request, and operations with an outcount complete
+//! the requests in the indices array. Otherwise, all requests complete when
+//! the operation has no flag or the flag is set
+template <bool Test, int Count, int Requests, int Flag, int Index, int Outcount, int Indices>
+struct CompletionArguments : NoArguments {
+    static constexpr bool Polls = Test;
+    static constexpr bool Completes = true;
+
+    //! \brief Check whether the test completed any request
+    //!
+    //! The test succeeds if the flag is set or the outcount is not zero
+    template <typename... Params>
+    static bool succeeded(Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        if constexpr (Flag >= 0)
+            return Convert::integer(std::get<Flag>(args)) != 0;
+        else
+            return Convert::integer(std::get<Outcount>(args)) != 0;
+    }
+
+    //! \brief Call a function for each request passed to the operation
+    template <Operation::Lang Lang, typename FuncTy, typename... Params>
+    static void requests(FuncTy func, Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        int count = 1;
+        if constexpr (Count >= 0)
+            count = Convert::integer(std::get<Count>(args));
+
+        for (int r = 0; r < count; ++r)
+            func(Convert::request<Lang>(std::get<Requests>(args), r));
+    }
+
+    //! \brief Call a function for the index of each completed request
+    template <Operation::Lang Lang, typename FuncTy, typename... Params>
+    static void completed(FuncTy func, Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        if constexpr (Flag >= 0) {
+            if (Convert::integer(std::get<Flag>(args)) == 0)
+                return;
+        }
+
+        if constexpr (Index >= 0) {
+            int index = Convert::index<Lang>(std::get<Index>(args), 0);
+            if (index >= 0)
+                func(index);
+        } else if constexpr (Outcount >= 0) {
+            int outcount = Convert::integer(std::get<Outcount>(args));
+            for (int o = 0; o < outcount; ++o) {
+                int index = Convert::index<Lang>(std::get<Indices>(args), o);
+                if (index >= 0)
+                    func(index);
+            }
+        } else {
+            int count = 1;
+            if constexpr (Count >= 0)
+                count = Convert::integer(std::get<Count>(args));
+
+            for (int r = 0; r < count; ++r)
+                func(r);
+        }
+    }
+};
+
+//! Class describing the position of the communicator argument of blocking
+//! collective operations
+template <int Comm>
+struct CollectiveArguments : NoArguments {
+    static constexpr bool Collective = true;
+
+    //! \brief Get the communicator identifier
+    template <typename... Params>
+    static int32_t comm(Params ...params)
+    {
+        return Convert::comm(std::get<Comm>(std::forward_as_tuple(params...)));
+    }
+};
+
+//! Class describing the operations that initialize a persistent send, whose
+//! message is sent at each start of the request instead of at the call
+template <typename MessageArgumentsTy>
+struct PersistentSendArguments : NoArguments {
+    static constexpr bool PersistentSends = true;
+
+    //! \brief Get the information of the message sent at each start
+    template <typename... Params>
+    static Message sent(Params ...params)
+    {
+        return MessageArgumentsTy::sent(params...);
+    }
+};
+
+//! Class describing the position of the arguments of the operations that
+//! start persistent requests. A negative count position means the operation
+//! starts a single request
+template <int Count, int Requests>
+struct StartArguments : NoArguments {
+    static constexpr bool Starts = true;
+
+    //! \brief Get the number of started requests
+    template <typename... Params>
+    static int count(Params ...params)
+    {
+        if constexpr (Count >= 0)
+            return Convert::integer(std::get<Count>(std::forward_as_tuple(params...)));
+        return 1;
+    }
+
+    //! \brief Get the C handle of a started request
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_Request request(int index, Params ...params)
+    {
+        return Convert::request<Lang>(std::get<Requests>(std::forward_as_tuple(params...)), index);
+    }
+};
+
+//! Class describing the position of the arguments of the operations that
+//! create or free an RMA window. The window argument is a pointer to the
+//! window handle. A negative communicator position means the operation frees
+//! the window
+template <int Comm, int Win>
+struct WindowArguments : NoArguments {
+    static constexpr bool CreatesWindow = (Comm >= 0);
+    static constexpr bool FreesWindow = (Comm < 0);
+
+    //! \brief Get the communicator identifier
+    template <typename... Params>
+    static int32_t comm(Params ...params)
+    {
+        return Convert::comm(std::get<Comm>(std::forward_as_tuple(params...)));
+    }
+
+    //! \brief Get the C handle of the window
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_Win window(Params ...params)
+    {
+        return Convert::window<Lang>(std::get<Win>(std::forward_as_tuple(params...)));
+    }
+};
+
+//! Data accessed by an RMA operation
+struct Access {
+    int32_t _target;
+    uint64_t _written;
+    uint64_t _read;
+};
+
+//! Class describing the position of the arguments of the RMA communication
+//! operations. The written data is transferred to the target and the read
+//! data is transferred from the target. A negative type position means the
+//! operation does not transfer data in that direction, and a negative count
+//! position means it transfers a single element
+template <int WriteCount, int WriteType, int ReadCount, int ReadType, int Target, int Win>
+struct AccessArguments : NoArguments {
+    static constexpr bool Accesses = true;
+
+    //! Whether the operation writes or reads the target memory
+    static constexpr bool Writes = (WriteType >= 0);
+    static constexpr bool Reads = (ReadType >= 0);
+
+    //! \brief Get the data accessed by the operation
+    template <typename... Params>
+    static Access accessed(Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        Access access = { Convert::integer(std::get<Target>(args)), 0, 0 };
+
+        if constexpr (Writes) {
+            MPI_Count count = 1;
+            if constexpr (WriteCount >= 0)
+                count = Convert::count(std::get<WriteCount>(args));
+            access._written = Datatype::bytes(count, Convert::datatype(std::get<WriteType>(args)));
+        }
+        if constexpr (Reads) {
+            MPI_Count count = 1;
+            if constexpr (ReadCount >= 0)
+                count = Convert::count(std::get<ReadCount>(args));
+            access._read = Datatype::bytes(count, Convert::datatype(std::get<ReadType>(args)));
+        }
+        return access;
+    }
+
+    //! \brief Get the C handle of the window
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_Win window(Params ...params)
+    {
+        return Convert::window<Lang>(std::get<Win>(std::forward_as_tuple(params...)));
+    }
+};
+
+//! Class describing the position of the arguments of the RMA synchronization
+//! operations. A negative target position means the operation synchronizes
+//! with all or a group of target processes. The operations with a flag poll
+//! for the end of the epoch and only synchronize when they succeed
+template <int Target, int Win, int Flag = -1>
+struct SyncArguments : PollArguments<Flag> {
+    static constexpr bool Synchronizes = true;
+
+    //! \brief Check whether the operation synchronized the window
+    template <typename... Params>
+    static bool synchronized(Params ...params)
+    {
+        if constexpr (Flag >= 0)
+            return PollArguments<Flag>::succeeded(params...);
+        return true;
+    }
+
+    //! \brief Get the target rank or -1 if there is no single target
+    template <typename... Params>
+    static int32_t target(Params ...params)
+    {
+        if constexpr (Target >= 0)
+            return Convert::integer(std::get<Target>(std::forward_as_tuple(params...)));
+        return -1;
+    }
+
+    //! \brief Get the C handle of the window
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_Win window(Params ...params)
+    {
+        return Convert::window<Lang>(std::get<Win>(std::forward_as_tuple(params...)));
+    }
+};
+
+//! Class describing the position of the arguments of the operations that open
+//! or close a file. The file argument is a pointer to the file handle. A
+//! negative communicator position means the operation closes the file
+template <int Comm, int File>
+struct FileArguments : NoArguments {
+    static constexpr bool OpensFile = (Comm >= 0);
+    static constexpr bool ClosesFile = (Comm < 0);
+
+    //! \brief Get the communicator identifier
+    template <typename... Params>
+    static int32_t comm(Params ...params)
+    {
+        return Convert::comm(std::get<Comm>(std::forward_as_tuple(params...)));
+    }
+
+    //! \brief Get the C handle of the file
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_File file(Params ...params)
+    {
+        return Convert::file<Lang>(std::get<File>(std::forward_as_tuple(params...)));
+    }
+};
+
+//! The file pointer that locates the data of a file access
+enum class FilePointer {
+    //! The access passes an explicit offset
+    Explicit = 0,
+    //! The access starts at the individual file pointer of the process
+    Individual,
+    //! The access starts at the file pointer shared by the processes
+    Shared,
+};
+
+//! Class describing the arguments of the file accesses: (file, buf, count,
+//! type, ...) or (file, offset, buf, count, type, ...) when the offset is
+//! explicit. The size of an access is the size of the posted buffer
+template <bool Write, FilePointer Pointer>
+struct FileAccessArguments : NoArguments {
+    static constexpr bool AccessesFile = true;
+
+    //! Whether the operation writes the file
+    static constexpr bool WritesFile = Write;
+
+    //! The file pointer of the access
+    static constexpr FilePointer AccessPointer = Pointer;
+
+    //! The position of the count argument
+    static constexpr int Count = (Pointer == FilePointer::Explicit) ? 3 : 2;
+
+    //! \brief Get the size of the access in bytes
+    template <typename... Params>
+    static uint64_t bytes(Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        MPI_Count count = Convert::count(std::get<Count>(args));
+        return Datatype::bytes(count, Convert::datatype(std::get<Count + 1>(args)));
+    }
+
+    //! \brief Get the explicit offset in etype units relative to the view
+    template <typename... Params>
+    static MPI_Offset offset(Params ...params)
+    {
+        if constexpr (Pointer == FilePointer::Explicit)
+            return Convert::offset(std::get<1>(std::forward_as_tuple(params...)));
+        return 0;
+    }
+
+    //! \brief Get the C handle of the file
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_File file(Params ...params)
+    {
+        return Convert::file<Lang>(std::get<0>(std::forward_as_tuple(params...)));
+    }
+};
+
+//! The layout of the blocks that a neighborhood collective exchanges with
+//! each neighbor: the same count and type for all neighbors, a count per
+//! neighbor with the same type, or a count and a type per neighbor
+enum class NeighborBlocks {
+    Uniform,
+    Counts,
+    Types
+};
+
+//! Class describing the position of the arguments of the neighborhood
+//! collectives. The blocks are exchanged with the sources and destinations of
+//! the topology in order. The blocking versions are also collectives
+template <bool Blocking,
+          NeighborBlocks SendBlocks, int SendCount, int SendType,
+          NeighborBlocks RecvBlocks, int RecvCount, int RecvType, int Comm>
+struct NeighborArguments : CollectiveArguments<Comm> {
+    static constexpr bool Collective = Blocking;
+    static constexpr bool Neighborhood = true;
+
+    //! \brief Get the bytes sent to a destination
+    //!
+    //! \param index The index of the destination in the topology
+    template <Operation::Lang Lang, typename... Params>
+    static uint64_t sent(int index, Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        return block<Lang, SendBlocks, SendCount, SendType>(args, index);
+    }
+
+    //! \brief Get the bytes received from a source
+    //!
+    //! \param index The index of the source in the topology
+    template <Operation::Lang Lang, typename... Params>
+    static uint64_t received(int index, Params ...params)
+    {
+        auto args = std::forward_as_tuple(params...);
+        return block<Lang, RecvBlocks, RecvCount, RecvType>(args, index);
+    }
+
+private:
+    //! \brief Get the bytes of the block of a neighbor
+    template <Operation::Lang Lang, NeighborBlocks Blocks, int Count, int Type, typename ArgsTy>
+    static uint64_t block(const ArgsTy &args, int index)
+    {
+        if constexpr (Blocks == NeighborBlocks::Uniform)
+            return Datatype::bytes(Convert::count(std::get<Count>(args)),
+                                   Convert::datatype(std::get<Type>(args)));
+        else if constexpr (Blocks == NeighborBlocks::Counts)
+            return Datatype::bytes(Convert::count(std::get<Count>(args)[index]),
+                                   Convert::datatype(std::get<Type>(args)));
+        else
+            return Datatype::bytes(Convert::count(std::get<Count>(args)[index]),
+                                   Convert::datatype<Lang>(std::get<Type>(args), index));
+    }
+};
+
+//! Class describing the position of the new communicator argument of the
+//! operations that create a communicator, which may have a topology
+template <int NewComm, bool Topology = false>
+struct CommArguments : NoArguments {
+    static constexpr bool CreatesComm = true;
+    static constexpr bool CreatesTopology = Topology;
+
+    //! \brief Get the identifier of the parent communicator
+    template <typename... Params>
+    static int32_t parent(Params ...params)
+    {
+        return Convert::comm(std::get<0>(std::forward_as_tuple(params...)));
+    }
+
+    //! \brief Get the C handle of the created communicator
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_Comm created(Params ...params)
+    {
+        return Convert::handle<Lang>(std::get<NewComm>(std::forward_as_tuple(params...)));
+    }
+};
+
+//! The relevant arguments of each operation. By default, operations do not
+//! have any relevant argument
+template <Operation::Code Code>
+struct Arguments : NoArguments {};
+
+//! Send primitives: (buf, count, type, dest, tag, comm, ...)
+using SendArguments = MessageArguments<1, 2, 3, 4, -1, -1, -1, -1, 5, -1>;
+
+//! Receive primitives: (buf, count, type, source, tag, comm, status)
+using RecvArguments = MessageArguments<-1, -1, -1, -1, 1, 2, 3, 4, 5, 6>;
+using IrecvArguments = MessageArguments<-1, -1, -1, -1, 1, 2, 3, 4, 5, -1>;
+
+//! Sendrecv primitives: (sbuf, scount, stype, dest, stag, rbuf, rcount, rtype,
+//! source, rtag, comm, status)
+using SendrecvArguments = MessageArguments<1, 2, 3, 4, 6, 7, 8, 9, 10, 11>;
+using IsendrecvArguments = MessageArguments<1, 2, 3, 4, 6, 7, 8, 9, 10, -1>;
+
+//! Sendrecv replace primitives: (buf, count, type, dest, stag, source, rtag,
+//! comm, status)
+using SendrecvReplaceArguments = MessageArguments<1, 2, 3, 4, 1, 2, 5, 6, 7, 8>;
+using IsendrecvReplaceArguments = MessageArguments<1, 2, 3, 4, 1, 2, 5, 6, 7, -1>;
+
+template <> struct Arguments<Operation::Recv> : RecvArguments {};
+template <> struct Arguments<Operation::Send> : SendArguments {};
+template <> struct Arguments<Operation::Bsend> : SendArguments {};
+template <> struct Arguments<Operation::Rsend> : SendArguments {};
+template <> struct Arguments<Operation::Ssend> : SendArguments {};
+template <> struct Arguments<Operation::Sendrecv> : SendrecvArguments {};
+template <> struct Arguments<Operation::SendrecvReplace> : SendrecvReplaceArguments {};
+template <> struct Arguments<Operation::Irecv> : IrecvArguments {};
+template <> struct Arguments<Operation::Isend> : SendArguments {};
+template <> struct Arguments<Operation::Ibsend> : SendArguments {};
+template <> struct Arguments<Operation::Irsend> : SendArguments {};
+template <> struct Arguments<Operation::Issend> : SendArguments {};
+template <> struct Arguments<Operation::Isendrecv> : IsendrecvArguments {};
+template <> struct Arguments<Operation::IsendrecvReplace> : IsendrecvReplaceArguments {};
+
+//! Partitioned send primitives: (buf, partitions, count, type, dest, tag,
+//! comm, ...). The message includes all partitions
+struct PsendArguments : MessageArguments<2, 3, 4, 5, -1, -1, -1, -1, 6, -1> {
+    template <typename... Params>
+    static Message sent(Params ...params)
+    {
+        Message message = MessageArguments::sent(params...);
+        message._bytes *= Convert::count(std::get<1>(std::forward_as_tuple(params...)));
+        return message;
+    }
+};
+
+//! Persistent and partitioned sends report their message at each start. The
+//! partitioned arrival tests poll for the arrival of a partition: parrived
+//! (request, partition, flag, ...)
+template <> struct Arguments<Operation::BsendInit> : PersistentSendArguments<SendArguments> {};
+template <> struct Arguments<Operation::RsendInit> : PersistentSendArguments<SendArguments> {};
+template <> struct Arguments<Operation::SendInit> : PersistentSendArguments<SendArguments> {};
+template <> struct Arguments<Operation::SsendInit> : PersistentSendArguments<SendArguments> {};
+template <> struct Arguments<Operation::PsendInit> : PersistentSendArguments<PsendArguments> {};
+template <> struct Arguments<Operation::Parrived> : PollArguments<2> {};
+
+//! Start primitives: start (request) and startall (count, requests)
+template <> struct Arguments<Operation::Start> : StartArguments<-1, 0> {};
+template <> struct Arguments<Operation::Startall> : StartArguments<0, 1> {};
+
+//! Probe primitives: probe (source, tag, comm, status), iprobe (source, tag,
+//! comm, flag, status), mprobe (source, tag, comm, message, status) and
+//! improbe (source, tag, comm, flag, message, status). The matched receives of
+//! the probed messages have no relevant arguments
+template <> struct Arguments<Operation::Iprobe> : ProbeArguments<false, 3, 4> {};
+template <> struct Arguments<Operation::Mprobe> : ProbeArguments<true, -1, 4> {};
+template <> struct Arguments<Operation::Improbe> : ProbeArguments<true, 3, 5> {};
+
+//! Wait primitives: wait (request, ...), waitall (count, requests, ...),
+//! waitany (count, requests, index, ...) and waitsome (count, requests,
+//! outcount, indices, ...)
+template <> struct Arguments<Operation::Wait> : CompletionArguments<false, -1, 0, -1, -1, -1, -1> {};
+template <> struct Arguments<Operation::Waitall> : CompletionArguments<false, 0, 1, -1, -1, -1, -1> {};
+template <> struct Arguments<Operation::Waitany> : CompletionArguments<false, 0, 1, -1, 2, -1, -1> {};
+template <> struct Arguments<Operation::Waitsome> : CompletionArguments<false, 0, 1, -1, -1, 2, 3> {};
+
+//! Test primitives: test (request, flag, ...), testall (count, requests, flag,
+//! ...), testany (count, requests, index, flag, ...) and testsome (count,
+//! requests, outcount, indices, ...). A testsome without active requests
+//! returns an undefined outcount, which is considered a success
+template <> struct Arguments<Operation::Test> : CompletionArguments<true, -1, 0, 1, -1, -1, -1> {};
+template <> struct Arguments<Operation::Testall> : CompletionArguments<true, 0, 1, 2, -1, -1, -1> {};
+template <> struct Arguments<Operation::Testany> : CompletionArguments<true, 0, 1, 3, 2, -1, -1> {};
+template <> struct Arguments<Operation::Testsome> : CompletionArguments<true, 0, 1, -1, -1, 2, 3> {};
+
+//! Blocking collectives: the communicator follows the buffer, count, type,
+//! operation and root arguments, which are the same in all versions
+template <> struct Arguments<Operation::Allgather> : CollectiveArguments<6> {};
+template <> struct Arguments<Operation::Allgatherv> : CollectiveArguments<7> {};
+template <> struct Arguments<Operation::Allreduce> : CollectiveArguments<5> {};
+template <> struct Arguments<Operation::Alltoall> : CollectiveArguments<6> {};
+template <> struct Arguments<Operation::Alltoallv> : CollectiveArguments<8> {};
+template <> struct Arguments<Operation::Alltoallw> : CollectiveArguments<8> {};
+template <> struct Arguments<Operation::Barrier> : CollectiveArguments<0> {};
+template <> struct Arguments<Operation::Bcast> : CollectiveArguments<4> {};
+template <> struct Arguments<Operation::Gather> : CollectiveArguments<7> {};
+template <> struct Arguments<Operation::Gatherv> : CollectiveArguments<8> {};
+template <> struct Arguments<Operation::Reduce> : CollectiveArguments<6> {};
+template <> struct Arguments<Operation::ReduceScatter> : CollectiveArguments<5> {};
+template <> struct Arguments<Operation::ReduceScatterBlock> : CollectiveArguments<5> {};
+template <> struct Arguments<Operation::Scatter> : CollectiveArguments<7> {};
+template <> struct Arguments<Operation::Scatterv> : CollectiveArguments<8> {};
+template <> struct Arguments<Operation::Scan> : CollectiveArguments<5> {};
+template <> struct Arguments<Operation::Exscan> : CollectiveArguments<5> {};
+
+//! Window creation: create (base, size, unit, info, comm, win), allocate and
+//! allocate shared (size, unit, info, comm, base, win), create dynamic (info,
+//! comm, win) and free (win)
+template <> struct Arguments<Operation::WinAllocate> : WindowArguments<3, 5> {};
+template <> struct Arguments<Operation::WinAllocateShared> : WindowArguments<3, 5> {};
+template <> struct Arguments<Operation::WinCreate> : WindowArguments<4, 5> {};
+template <> struct Arguments<Operation::WinCreateDynamic> : WindowArguments<1, 2> {};
+template <> struct Arguments<Operation::WinFree> : WindowArguments<-1, 0> {};
+
+//! RMA communication: put and get (buf, count, type, target, disp, tcount,
+//! ttype, win, ...), accumulate (buf, count, type, target, disp, tcount,
+//! ttype, op, win, ...), get accumulate (buf, count, type, rbuf, rcount,
+//! rtype, target, disp, tcount, ttype, op, win, ...), fetch and op (buf, rbuf,
+//! type, target, disp, op, win) and compare and swap (buf, cbuf, rbuf, type,
+//! target, disp, win). The request-based versions append the request
+using PutArguments = AccessArguments<1, 2, -1, -1, 3, 7>;
+using GetArguments = AccessArguments<-1, -1, 1, 2, 3, 7>;
+using AccumulateArguments = AccessArguments<1, 2, -1, -1, 3, 8>;
+using GetAccumulateArguments = AccessArguments<1, 2, 4, 5, 6, 11>;
+
+template <> struct Arguments<Operation::Accumulate> : AccumulateArguments {};
+template <> struct Arguments<Operation::CompareAndSwap> : AccessArguments<-1, 3, -1, 3, 4, 6> {};
+template <> struct Arguments<Operation::FetchAndOp> : AccessArguments<-1, 2, -1, 2, 3, 6> {};
+template <> struct Arguments<Operation::Get> : GetArguments {};
+template <> struct Arguments<Operation::GetAccumulate> : GetAccumulateArguments {};
+template <> struct Arguments<Operation::Put> : PutArguments {};
+template <> struct Arguments<Operation::Raccumulate> : AccumulateArguments {};
+template <> struct Arguments<Operation::Rget> : GetArguments {};
+template <> struct Arguments<Operation::RgetAccumulate> : GetAccumulateArguments {};
+template <> struct Arguments<Operation::Rput> : PutArguments {};
+
+//! RMA active target synchronization: fence (assert, win), post and start
+//! (group, assert, win), complete and wait (win) and test (win, flag)
+template <> struct Arguments<Operation::WinFence> : SyncArguments<-1, 1> {};
+template <> struct Arguments<Operation::WinPost> : SyncArguments<-1, 2> {};
+template <> struct Arguments<Operation::WinStart> : SyncArguments<-1, 2> {};
+template <> struct Arguments<Operation::WinComplete> : SyncArguments<-1, 0> {};
+template <> struct Arguments<Operation::WinWait> : SyncArguments<-1, 0> {};
+template <> struct Arguments<Operation::WinTest> : SyncArguments<-1, 0, 1> {};
+
+//! RMA passive target synchronization: lock (type, target, assert, win),
+//! unlock, flush and flush local (target, win), lock all (assert, win), and
+//! unlock all, flush all, flush local all and sync (win)
+template <> struct Arguments<Operation::WinLock> : SyncArguments<1, 3> {};
+template <> struct Arguments<Operation::WinUnlock> : SyncArguments<0, 1> {};
+template <> struct Arguments<Operation::WinLockAll> : SyncArguments<-1, 1> {};
+template <> struct Arguments<Operation::WinUnlockAll> : SyncArguments<-1, 0> {};
+template <> struct Arguments<Operation::WinFlush> : SyncArguments<0, 1> {};
+template <> struct Arguments<Operation::WinFlushAll> : SyncArguments<-1, 0> {};
+template <> struct Arguments<Operation::WinFlushLocal> : SyncArguments<0, 1> {};
+template <> struct Arguments<Operation::WinFlushLocalAll> : SyncArguments<-1, 0> {};
+template <> struct Arguments<Operation::WinSync> : SyncArguments<-1, 0> {};
+
+//! File management: open (comm, name, mode, info, file) and close (file)
+template <> struct Arguments<Operation::FileOpen> : FileArguments<0, 4> {};
+template <> struct Arguments<Operation::FileClose> : FileArguments<-1, 0> {};
+
+//! File accesses of all forms. The ends of the split collectives have no
+//! relevant arguments, since the access is reported by their begin
+using ReadArguments = FileAccessArguments<false, FilePointer::Individual>;
+using ReadAtArguments = FileAccessArguments<false, FilePointer::Explicit>;
+using ReadSharedArguments = FileAccessArguments<false, FilePointer::Shared>;
+using WriteArguments = FileAccessArguments<true, FilePointer::Individual>;
+using WriteAtArguments = FileAccessArguments<true, FilePointer::Explicit>;
+using WriteSharedArguments = FileAccessArguments<true, FilePointer::Shared>;
+
+template <> struct Arguments<Operation::FileRead> : ReadArguments {};
+template <> struct Arguments<Operation::FileReadAt> : ReadAtArguments {};
+template <> struct Arguments<Operation::FileReadShared> : ReadSharedArguments {};
+template <> struct Arguments<Operation::FileWrite> : WriteArguments {};
+template <> struct Arguments<Operation::FileWriteAt> : WriteAtArguments {};
+template <> struct Arguments<Operation::FileWriteShared> : WriteSharedArguments {};
+template <> struct Arguments<Operation::FileReadAll> : ReadArguments {};
+template <> struct Arguments<Operation::FileReadAtAll> : ReadAtArguments {};
+template <> struct Arguments<Operation::FileReadOrdered> : ReadSharedArguments {};
+template <> struct Arguments<Operation::FileWriteAll> : WriteArguments {};
+template <> struct Arguments<Operation::FileWriteAtAll> : WriteAtArguments {};
+template <> struct Arguments<Operation::FileWriteOrdered> : WriteSharedArguments {};
+template <> struct Arguments<Operation::FileIread> : ReadArguments {};
+template <> struct Arguments<Operation::FileIreadAt> : ReadAtArguments {};
+template <> struct Arguments<Operation::FileIreadShared> : ReadSharedArguments {};
+template <> struct Arguments<Operation::FileIwrite> : WriteArguments {};
+template <> struct Arguments<Operation::FileIwriteAt> : WriteAtArguments {};
+template <> struct Arguments<Operation::FileIwriteShared> : WriteSharedArguments {};
+template <> struct Arguments<Operation::FileIreadAll> : ReadArguments {};
+template <> struct Arguments<Operation::FileIreadAtAll> : ReadAtArguments {};
+template <> struct Arguments<Operation::FileIwriteAll> : WriteArguments {};
+template <> struct Arguments<Operation::FileIwriteAtAll> : WriteAtArguments {};
+template <> struct Arguments<Operation::FileReadAllBegin> : ReadArguments {};
+template <> struct Arguments<Operation::FileReadAtAllBegin> : ReadAtArguments {};
+template <> struct Arguments<Operation::FileReadOrderedBegin> : ReadSharedArguments {};
+template <> struct Arguments<Operation::FileWriteAllBegin> : WriteArguments {};
+template <> struct Arguments<Operation::FileWriteAtAllBegin> : WriteAtArguments {};
+template <> struct Arguments<Operation::FileWriteOrderedBegin> : WriteSharedArguments {};
+
+//! Neighborhood collectives: allgather and alltoall (sbuf, scount, stype,
+//! rbuf, rcount, rtype, comm, ...), allgatherv (sbuf, scount, stype, rbuf,
+//! rcounts, displs, rtype, comm, ...), alltoallv (sbuf, scounts, sdispls,
+//! stype, rbuf, rcounts, rdispls, rtype, comm, ...) and alltoallw (sbuf,
+//! scounts, sdispls, stypes, rbuf, rcounts, rdispls, rtypes, comm, ...). The
+//! persistent versions exchange their blocks at each start, so their
+//! initializations have no relevant arguments
+template <bool Blocking>
+using NeighborUniformArguments = NeighborArguments<Blocking,
+    NeighborBlocks::Uniform, 1, 2, NeighborBlocks::Uniform, 4, 5, 6>;
+template <bool Blocking>
+using NeighborAllgathervArguments = NeighborArguments<Blocking,
+    NeighborBlocks::Uniform, 1, 2, NeighborBlocks::Counts, 4, 6, 7>;
+template <bool Blocking>
+using NeighborAlltoallvArguments = NeighborArguments<Blocking,
+    NeighborBlocks::Counts, 1, 3, NeighborBlocks::Counts, 5, 7, 8>;
+template <bool Blocking>
+using NeighborAlltoallwArguments = NeighborArguments<Blocking,
+    NeighborBlocks::Types, 1, 3, NeighborBlocks::Types, 5, 7, 8>;
+
+template <> struct Arguments<Operation::NeighborAllgather> : NeighborUniformArguments<true> {};
+template <> struct Arguments<Operation::NeighborAllgatherv> : NeighborAllgathervArguments<true> {};
+template <> struct Arguments<Operation::NeighborAlltoall> : NeighborUniformArguments<true> {};
+template <> struct Arguments<Operation::NeighborAlltoallv> : NeighborAlltoallvArguments<true> {};
+template <> struct Arguments<Operation::NeighborAlltoallw> : NeighborAlltoallwArguments<true> {};
+template <> struct Arguments<Operation::IneighborAllgather> : NeighborUniformArguments<false> {};
+template <> struct Arguments<Operation::IneighborAllgatherv> : NeighborAllgathervArguments<false> {};
+template <> struct Arguments<Operation::IneighborAlltoall> : NeighborUniformArguments<false> {};
+template <> struct Arguments<Operation::IneighborAlltoallv> : NeighborAlltoallvArguments<false> {};
+template <> struct Arguments<Operation::IneighborAlltoallw> : NeighborAlltoallwArguments<false> {};
+
+//! Topology communicator creation: cart create (comm, ndims, dims, periods,
+//! reorder, newcomm), graph create (comm, nnodes, index, edges, reorder,
+//! newcomm), dist graph create (comm, n, sources, degrees, destinations,
+//! weights, info, reorder, newcomm) and dist graph create adjacent (comm,
+//! indegree, sources, sweights, outdegree, destinations, dweights, info,
+//! reorder, newcomm)
+template <> struct Arguments<Operation::CartCreate> : CommArguments<5, true> {};
+template <> struct Arguments<Operation::GraphCreate> : CommArguments<5, true> {};
+template <> struct Arguments<Operation::DistGraphCreate> : CommArguments<8, true> {};
+template <> struct Arguments<Operation::DistGraphCreateAdjacent> : CommArguments<9, true> {};
+
+//! Communicator creation: dup (comm, newcomm), split (comm, color, key,
+//! newcomm), split type (comm, type, key, info, newcomm), create (comm, group,
+//! newcomm), create group (comm, group, tag, newcomm) and intercomm create
+//! (local comm, local leader, peer comm, remote leader, tag, newcomm)
+template <> struct Arguments<Operation::CommDup> : CommArguments<1> {};
+template <> struct Arguments<Operation::CommSplit> : CommArguments<3> {};
+template <> struct Arguments<Operation::CommSplitType> : CommArguments<4> {};
+template <> struct Arguments<Operation::CommCreate> : CommArguments<2> {};
+template <> struct Arguments<Operation::CommCreateGroup> : CommArguments<3> {};
+template <> struct Arguments<Operation::IntercommCreate> : CommArguments<5> {};
+
+} // namespace sonar
+
+#endif // ARGUMENTS_HPP
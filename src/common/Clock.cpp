@@ -0,0 +1,130 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <cmath>
+#include <tuple>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include "Clock.hpp"
+#include "IOHandler.hpp"
+
+namespace sonar {
+
+bool Clock::_tsc = false;
+uint64_t Clock::_scale = 0;
+uint64_t Clock::_anchorTicks = 0;
+uint64_t Clock::_ticks = 0;
+uint64_t Clock::_time = 0;
+thread_local Clock::Anchor Clock::_anchor;
+
+bool Clock::invariant()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    // The invariant TSC is reported in the advanced power management leaf
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+        return false;
+    return (edx & (1 << 8)) != 0;
+#elif defined(__aarch64__)
+    // The generic timer counter always runs at a constant rate
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::pair<uint64_t, uint64_t> Clock::sample()
+{
+    // Keep the sample with the shortest interval between the counter reads
+    uint64_t ticks = 0, time = 0;
+    uint64_t best = UINT64_MAX;
+    for (int s = 0; s < 8; ++s) {
+        uint64_t before = Clock::ticks();
+        uint64_t now = ovni_clock_now();
+        uint64_t after = Clock::ticks();
+
+        if (after - before < best) {
+            best = after - before;
+            ticks = before + (after - before) / 2;
+            time = now;
+        }
+    }
+    return { ticks, time };
+}
+
+uint64_t Clock::anchor(Anchor &anchor, uint64_t ticks)
+{
+    anchor._ticks = ticks;
+    anchor._time = ovni_clock_now();
+
+    // The new anchor may be behind the last converted timestamp
+    if (anchor._time < anchor._last)
+        anchor._time = anchor._last;
+    anchor._last = anchor._time;
+
+    return anchor._time;
+}
+
+void Clock::initialize(bool tsc)
+{
+    if (!tsc)
+        return;
+
+    if (!invariant()) {
+        IOHandler::warn("The timestamp counter is not invariant; using the ovni clock");
+        return;
+    }
+
+    // Measure the frequency of the counter while spinning
+    std::tie(_ticks, _time) = sample();
+    uint64_t ticks = 0, time = 0;
+    do {
+        std::tie(ticks, time) = sample();
+    } while (time - _time < CalibrationTime);
+
+    if (ticks <= _ticks) {
+        IOHandler::warn("The timestamp counter does not advance; using the ovni clock");
+        return;
+    }
+    _scale = ((unsigned __int128) (time - _time) << 32) / (ticks - _ticks);
+    _anchorTicks = ((unsigned __int128) AnchorPeriod << 32) / _scale;
+
+    // Check the calibration against the ovni clock over another interval
+    uint64_t checkTicks = 0, checkTime = 0;
+    do {
+        std::tie(checkTicks, checkTime) = sample();
+    } while (checkTime - time < CheckTime);
+
+    double predicted = time + convert(checkTicks - ticks);
+    double error = std::fabs(predicted - checkTime) / (checkTime - time) * 1e6;
+    if (error > MaxError) {
+        IOHandler::warn("The timestamp counter has an error of ", error,
+                        " ppm; using the ovni clock");
+        return;
+    }
+
+    _tsc = true;
+}
+
+void Clock::finalize()
+{
+    if (!_tsc)
+        return;
+
+    auto [ticks, time] = sample();
+    if (time <= _time)
+        return;
+
+    double predicted = _time + convert(ticks - _ticks);
+    double error = std::fabs(predicted - time) / (time - _time) * 1e6;
+    IOHandler::warnIf(error > MaxError, "The timestamp counter deviated ", error,
+                      " ppm from the ovni clock during the execution");
+}
+
+} // namespace sonar
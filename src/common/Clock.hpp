@@ -0,0 +1,136 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef CLOCK_HPP
+#define CLOCK_HPP
+
+#include <cstdint>
+#include <ovni.h>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace sonar {
+
+//! Class that provides the timestamps of the instrumentation in nanoseconds
+//! of the ovni clock. By default, the timestamps are read from the ovni clock.
+//! Optionally, they are derived from the CPU timestamp counter, which is
+//! calibrated against the ovni clock at initialization. Each thread converts
+//! the ticks since its own anchor, which is re-anchored to the ovni clock
+//! periodically to bound the conversion error, and its timestamps never go
+//! backwards
+class Clock {
+private:
+    //! The anchor of a thread to the ovni clock
+    struct Anchor {
+        uint64_t _ticks;
+        uint64_t _time;
+        uint64_t _last;
+    };
+
+    //! The duration of the calibration and the accuracy check
+    static constexpr uint64_t CalibrationTime = 10000000;
+    static constexpr uint64_t CheckTime = 2000000;
+
+    //! The period of the re-anchoring of the threads
+    static constexpr uint64_t AnchorPeriod = 1000000;
+
+    //! The maximum relative error of the calibrated frequency in parts per
+    //! million. Larger errors fall back to the ovni clock at initialization
+    //! and are reported at finalization
+    static constexpr double MaxError = 100.0;
+
+    //! Whether the timestamps are derived from the timestamp counter
+    static bool _tsc;
+
+    //! The nanoseconds per tick as a 32.32 fixed-point number
+    static uint64_t _scale;
+
+    //! The ticks between re-anchorings
+    static uint64_t _anchorTicks;
+
+    //! The global anchor taken at the calibration
+    static uint64_t _ticks;
+    static uint64_t _time;
+
+    //! The anchor of each thread
+    static thread_local Anchor _anchor;
+
+    //! \brief Read the timestamp counter
+    static uint64_t ticks()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        uint64_t value;
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+        return value;
+#else
+        return 0;
+#endif
+    }
+
+    //! \brief Convert a number of ticks to nanoseconds
+    static uint64_t convert(uint64_t ticks)
+    {
+        return ((unsigned __int128) ticks * _scale) >> 32;
+    }
+
+    //! \brief Check whether the timestamp counter runs at a constant rate
+    //! regardless of the frequency and power states of the cores
+    static bool invariant();
+
+    //! \brief Read the timestamp counter and the ovni clock at the same time
+    //!
+    //! \returns The counter ticks and the ovni clock time
+    static std::pair<uint64_t, uint64_t> sample();
+
+    //! \brief Re-anchor the current thread to the ovni clock
+    //!
+    //! \returns The current timestamp
+    static uint64_t anchor(Anchor &anchor, uint64_t ticks);
+
+public:
+    //! \brief Initialize the clock
+    //!
+    //! The timestamp counter is calibrated and checked when requested. The
+    //! ovni clock is used when the counter is not invariant or not accurate
+    //!
+    //! \param tsc Whether the timestamps should be derived from the timestamp
+    //! counter
+    static void initialize(bool tsc);
+
+    //! \brief Check the accuracy of the timestamp counter over the execution
+    //!
+    //! Reports a warning when the frequency measured since the calibration
+    //! deviates from the calibrated one
+    static void finalize();
+
+    //! \brief Get the current time in nanoseconds
+    static uint64_t now()
+    {
+        if (!_tsc)
+            return ovni_clock_now();
+
+        Anchor &anchor = _anchor;
+        uint64_t current = ticks();
+        uint64_t elapsed = current - anchor._ticks;
+        if (__builtin_expect(elapsed >= _anchorTicks, 0))
+            return Clock::anchor(anchor, current);
+
+        uint64_t time = anchor._time + ((elapsed * _scale) >> 32);
+        if (time < anchor._last)
+            time = anchor._last;
+        anchor._last = time;
+        return time;
+    }
+};
+
+} // namespace sonar
+
+#endif // CLOCK_HPP
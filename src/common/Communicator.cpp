@@ -0,0 +1,56 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <numeric>
+
+#include "Communicator.hpp"
+#include "IOHandler.hpp"
+
+namespace sonar {
+
+void Communicator::translate(int32_t comm, Translation &translation)
+{
+    MPI_Comm handle = MPI_Comm_f2c(comm);
+
+    int result;
+    PMPI_Comm_compare(handle, MPI_COMM_WORLD, &result);
+    if (result == MPI_IDENT || result == MPI_CONGRUENT) {
+        translation._identity = true;
+        translation._ranks.clear();
+        return;
+    }
+
+    // The peers of intercommunicators are ranks of the remote group
+    int inter;
+    PMPI_Comm_test_inter(handle, &inter);
+
+    MPI_Group group, world;
+    int err = (inter) ? PMPI_Comm_remote_group(handle, &group)
+                      : PMPI_Comm_group(handle, &group);
+    if (err != MPI_SUCCESS)
+        IOHandler::fail("Could not retrieve the group of a communicator");
+
+    if (PMPI_Comm_group(MPI_COMM_WORLD, &world) != MPI_SUCCESS)
+        IOHandler::fail("Could not retrieve the group of the world communicator");
+
+    int size;
+    PMPI_Group_size(group, &size);
+
+    std::vector<int> ranks(size), worldRanks(size);
+    std::iota(ranks.begin(), ranks.end(), 0);
+
+    err = PMPI_Group_translate_ranks(group, size, ranks.data(), world, worldRanks.data());
+    if (err != MPI_SUCCESS)
+        IOHandler::fail("Could not translate the ranks of a communicator");
+
+    PMPI_Group_free(&group);
+    PMPI_Group_free(&world);
+
+    translation._identity = false;
+    translation._ranks.assign(worldRanks.begin(), worldRanks.end());
+}
+
+} // namespace sonar
@@ -0,0 +1,66 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef COMMUNICATOR_HPP
+#define COMMUNICATOR_HPP
+
+#include <cstdint>
+#include <mpi.h>
+#include <vector>
+
+#include "Utils.hpp"
+
+namespace sonar {
+
+//! Class that translates the ranks of the communicators to ranks of the world
+//! communicator. Each thread caches the translation of the communicators it
+//! used, indexed by their identifier
+class Communicator {
+private:
+    //! The translation of a communicator. The world communicator and its
+    //! duplicates have an identity translation
+    struct Translation {
+        bool _identity;
+        std::vector<int32_t> _ranks;
+    };
+
+    //! The per-thread cache of translations
+    using Cache = HandleCache<Communicator, int32_t, Translation>;
+
+    //! \brief Compute the translation of a communicator
+    static void translate(int32_t comm, Translation &translation);
+
+public:
+    //! \brief Get the world rank of a rank in a communicator
+    //!
+    //! In intercommunicators, the rank refers to the remote group. Special
+    //! ranks, such as MPI_PROC_NULL, are returned as they are
+    //!
+    //! \param comm The communicator identifier
+    //! \param rank The rank in the communicator
+    static int32_t worldRank(int32_t comm, int32_t rank)
+    {
+        if (rank < 0)
+            return rank;
+
+        const Translation &translation = Cache::get(comm, &translate);
+        if (translation._identity)
+            return rank;
+        if ((size_t) rank >= translation._ranks.size())
+            return MPI_UNDEFINED;
+        return translation._ranks[rank];
+    }
+
+    //! \brief Invalidate the cached translations of all threads
+    static void invalidate()
+    {
+        Cache::invalidate();
+    }
+};
+
+} // namespace sonar
+
+#endif // COMMUNICATOR_HPP
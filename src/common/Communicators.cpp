@@ -0,0 +1,141 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <algorithm>
+#include <numeric>
+
+#include "Communicators.hpp"
+#include "IOHandler.hpp"
+#include "Utils.hpp"
+
+namespace sonar {
+
+bool Communicators::_enabled = false;
+std::unordered_map<int32_t, uint64_t> Communicators::_ids;
+std::unordered_map<uint64_t, uint64_t> Communicators::_sequences;
+std::mutex Communicators::_lock;
+
+//! \brief Get the world ranks of the members of a group
+static std::vector<int> worldRanks(MPI_Group group)
+{
+    MPI_Group world;
+    if (PMPI_Comm_group(MPI_COMM_WORLD, &world) != MPI_SUCCESS)
+        IOHandler::fail("Could not retrieve the group of the world communicator");
+
+    int size;
+    PMPI_Group_size(group, &size);
+
+    std::vector<int> ranks(size), worldRanks(size);
+    std::iota(ranks.begin(), ranks.end(), 0);
+
+    if (PMPI_Group_translate_ranks(group, size, ranks.data(), world, worldRanks.data()) != MPI_SUCCESS)
+        IOHandler::fail("Could not translate the ranks of a communicator");
+
+    PMPI_Group_free(&world);
+    return worldRanks;
+}
+
+//! \brief Get the hash of the world ranks of the members of a group
+static uint64_t hash(MPI_Group group)
+{
+    uint64_t hash = 0;
+    for (int rank : worldRanks(group))
+        hash = Utils::mix(hash ^ (uint32_t) rank);
+    return hash;
+}
+
+void Communicators::initialize()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _ids[MPI_Comm_c2f(MPI_COMM_WORLD)] = 0;
+}
+
+uint64_t Communicators::fingerprint(MPI_Comm comm)
+{
+    MPI_Group group;
+    if (PMPI_Comm_group(comm, &group) != MPI_SUCCESS)
+        IOHandler::fail("Could not retrieve the group of a communicator");
+
+    uint64_t local = hash(group);
+    PMPI_Group_free(&group);
+
+    int inter;
+    PMPI_Comm_test_inter(comm, &inter);
+    if (!inter)
+        return local;
+
+    if (PMPI_Comm_remote_group(comm, &group) != MPI_SUCCESS)
+        IOHandler::fail("Could not retrieve the remote group of a communicator");
+
+    uint64_t remote = hash(group);
+    PMPI_Group_free(&group);
+
+    // Combine the groups in the same order on both sides
+    return Utils::mix(std::min(local, remote) ^ Utils::mix(std::max(local, remote)));
+}
+
+uint64_t Communicators::derive(uint64_t parent, MPI_Comm comm)
+{
+    // Each group of an intercommunicator has its own parent
+    int inter;
+    PMPI_Comm_test_inter(comm, &inter);
+    if (inter)
+        parent = Unknown;
+
+    uint64_t key = Utils::mix(parent ^ Utils::mix(fingerprint(comm)));
+
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        sequence = _sequences[key]++;
+    }
+
+    // Zero is the identifier of the world communicator
+    uint64_t id = Utils::mix(key ^ Utils::mix(sequence + 1));
+    return (id != 0) ? id : 1;
+}
+
+uint64_t Communicators::create(int32_t parent, MPI_Comm comm)
+{
+    uint64_t key = Unknown;
+    identifier(parent, key);
+
+    uint64_t id = derive(key, comm);
+
+    // Replace any stale entry of a communicator that was freed without our
+    // wrapper
+    std::lock_guard<std::mutex> guard(_lock);
+    _ids[MPI_Comm_c2f(comm)] = id;
+    return id;
+}
+
+bool Communicators::members(MPI_Comm comm, Members &members)
+{
+    int rank;
+    PMPI_Comm_rank(comm, &rank);
+    if (rank != 0)
+        return false;
+
+    MPI_Group group;
+    if (PMPI_Comm_group(comm, &group) != MPI_SUCCESS)
+        IOHandler::fail("Could not retrieve the group of a communicator");
+
+    std::vector<int> ranks = worldRanks(group);
+    PMPI_Group_free(&group);
+
+    members._size = ranks.size();
+    members._ranges.clear();
+    for (size_t r = 0; r < ranks.size(); ++r) {
+        size_t n = members._ranges.size();
+        if (n > 0 && members._ranges[n - 2] + members._ranges[n - 1] == ranks[r])
+            ++members._ranges[n - 1];
+        else
+            members._ranges.insert(members._ranges.end(), { ranks[r], 1 });
+    }
+    return true;
+}
+
+} // namespace sonar
@@ -0,0 +1,147 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef COMMUNICATORS_HPP
+#define COMMUNICATORS_HPP
+
+#include <cstdint>
+#include <mpi.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace sonar {
+
+//! Class that assigns job-wide identifiers to the communicators. The members
+//! of a communicator derive its identifier locally when it is created, so the
+//! identifier can be used to correlate the calls of all members without any
+//! communication. The world communicator has identifier zero
+class Communicators {
+public:
+    //! The world ranks of the members of a communicator as ranges of
+    //! consecutive ranks, which keeps the membership of large communicators
+    //! compact. The ranges are pairs of first rank and number of ranks
+    struct Members {
+        int32_t _size;
+        std::vector<int32_t> _ranges;
+    };
+
+private:
+    //! The parent key of the communicators whose parent has no job-wide
+    //! identifier
+    static constexpr uint64_t Unknown = UINT64_MAX;
+
+    //! Whether the registry is enabled
+    static bool _enabled;
+
+    //! The identifier of each communicator created through the wrappers
+    static std::unordered_map<int32_t, uint64_t> _ids;
+
+    //! The number of communicators derived from each parent and group,
+    //! indexed by the key of the pair
+    static std::unordered_map<uint64_t, uint64_t> _sequences;
+
+    //! The lock protecting the identifiers and the sequences
+    static std::mutex _lock;
+
+    //! \brief Get the hash of the world ranks of the members of a
+    //! communicator
+    //!
+    //! Intercommunicators combine the hashes of both groups, so the members
+    //! of both sides get the same hash
+    static uint64_t fingerprint(MPI_Comm comm);
+
+    //! \brief Derive the identifier of a communicator from its parent
+    //!
+    //! The identifier combines the parent key, the hash of the members and
+    //! the number of communicators with the same members derived from the
+    //! same parent. All members create these communicators in the same order,
+    //! so they compute the same identifier without communicating
+    static uint64_t derive(uint64_t parent, MPI_Comm comm);
+
+public:
+    //! \brief Enable the registry
+    static void enable()
+    {
+        _enabled = true;
+    }
+
+    //! \brief Check whether the registry is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Initialize the registry after the MPI initialization
+    //!
+    //! The world communicator is registered with identifier zero
+    static void initialize();
+
+    //! \brief Register a created communicator
+    //!
+    //! The identifier is derived from the parent communicator and the world
+    //! ranks of the members, without communication. The intercommunicators
+    //! are only derived from their members, since each group passes its own
+    //! parent
+    //!
+    //! \param parent The identifier of the parent communicator
+    //! \param comm The created communicator
+    //!
+    //! \returns The job-wide identifier of the communicator
+    static uint64_t create(int32_t parent, MPI_Comm comm);
+
+    //! \brief Identify a communicator that was not created through the
+    //! wrappers
+    //!
+    //! The identifier is derived from the world ranks of the members. It is
+    //! not registered, so it never becomes the parent of other communicators,
+    //! which could disagree across members depending on when they identified
+    //! it. The members must identify these communicators in the same order,
+    //! e.g., at their first collective call
+    //!
+    //! \returns The job-wide identifier of the communicator
+    static uint64_t identify(MPI_Comm comm)
+    {
+        return derive(Unknown, comm);
+    }
+
+    //! \brief Get the job-wide identifier of a registered communicator
+    //!
+    //! \param comm The communicator identifier
+    //! \param id The job-wide identifier if the communicator is registered
+    //!
+    //! \returns Whether the communicator is registered
+    static bool identifier(int32_t comm, uint64_t &id)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        auto it = _ids.find(comm);
+        if (it == _ids.end())
+            return false;
+        id = it->second;
+        return true;
+    }
+
+    //! \brief Get the members of the local group of a communicator
+    //!
+    //! Only the first member of the group gets the members, so they are
+    //! reported once per group
+    //!
+    //! \returns Whether the current process is the first member
+    static bool members(MPI_Comm comm, Members &members);
+
+    //! \brief Forget a freed communicator
+    //!
+    //! \param comm The communicator identifier
+    static void release(int32_t comm)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _ids.erase(comm);
+    }
+};
+
+} // namespace sonar
+
+#endif // COMMUNICATORS_HPP
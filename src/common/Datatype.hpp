@@ -0,0 +1,70 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef DATATYPE_HPP
+#define DATATYPE_HPP
+
+#include <cstdint>
+#include <mpi.h>
+
+#include "Utils.hpp"
+
+namespace sonar {
+
+//! Class that caches the size of the MPI datatypes
+class Datatype {
+private:
+    //! The per-thread cache of datatype sizes
+    using Cache = HandleCache<Datatype, MPI_Datatype, MPI_Count>;
+
+public:
+    //! \brief Get the size in bytes of a datatype
+    //!
+    //! Invalid datatypes and sizes that do not fit in a count are reported
+    //! as zero bytes and are not cached. The wrapped call reports the error
+    //! to the application according to its error handler
+    //!
+    //! \param type The datatype
+    static MPI_Count size(MPI_Datatype type)
+    {
+        const MPI_Count *cached = Cache::find(type);
+        if (cached != nullptr)
+            return *cached;
+
+        // Avoid raising the error of a null datatype outside the wrapped call
+        if (type == MPI_DATATYPE_NULL)
+            return 0;
+
+        MPI_Count size;
+        if (PMPI_Type_size_x(type, &size) != MPI_SUCCESS || size == MPI_UNDEFINED)
+            return 0;
+
+        Cache::insert(type) = size;
+        return size;
+    }
+
+    //! \brief Get the size in bytes of a number of elements
+    //!
+    //! \param count The number of elements
+    //! \param type The datatype of the elements
+    static uint64_t bytes(MPI_Count count, MPI_Datatype type)
+    {
+        if (count <= 0)
+            return 0;
+
+        return (uint64_t) count * size(type);
+    }
+
+    //! \brief Invalidate the cached sizes of all threads
+    static void invalidate()
+    {
+        Cache::invalidate();
+    }
+};
+
+} // namespace sonar
+
+#endif // DATATYPE_HPP
@@ -10,106 +10,158 @@
 #include "Manager.hpp"
 #include "Symbol.hpp"
 
+//! Declare the target of the wrapper of a function. The PMPI build points the
+//! target to the profiling symbol, whose name is built by the PROFILING_NAME
+//! macro of the including file. The callers of the wrappers with pinned
+//! targets are never rebound to the targets
+#ifdef SONAR_PMPI
+#define DECLARE_TARGET(ret, name, ...)                                         \
+    ret PROFILING_NAME(name)(__VA_ARGS__);                                     \
+    static Symbol::Target<ret(__VA_ARGS__)> name##_target(                     \
+            #name, &PROFILING_NAME(name));
+#define DECLARE_PINNED_TARGET(ret, name, ...)                                  \
+    ret PROFILING_NAME(name)(__VA_ARGS__);                                     \
+    static Symbol::Target<ret(__VA_ARGS__)> name##_target(                     \
+            #name, &PROFILING_NAME(name), true);
+#else
+#define DECLARE_TARGET(ret, name, ...)                                         \
+    static Symbol::Target<ret(__VA_ARGS__)> name##_target(#name);
+#define DECLARE_PINNED_TARGET(ret, name, ...)                                  \
+    static Symbol::Target<ret(__VA_ARGS__)> name##_target(#name, true);
+#endif
+
 #define DEFINE_FUNC0(lang, op, cnt, ret, name)                                 \
+    DECLARE_TARGET(ret, name)                                                  \
     ret name(void)                                                             \
     {                                                                          \
-        return Manager::process<lang, op, cnt, ret>(#name);                    \
+        return Manager::process<lang, op, cnt, ret>(name##_target);            \
     }
 
 #define DEFINE_FUNC1(lang, op, cnt, ret, name, t0)                             \
+    DECLARE_TARGET(ret, name, t0)                                              \
     ret name(t0 p0)                                                            \
     {                                                                          \
-        return Manager::process<lang, op, cnt, ret>(#name, p0);                \
+        return Manager::process<lang, op, cnt, ret>(name##_target, p0);        \
     }
 
 #define DEFINE_FUNC2(lang, op, cnt, ret, name, t0, t1)                         \
+    DECLARE_TARGET(ret, name, t0, t1)                                          \
     ret name(t0 p0, t1 p1)                                                     \
     {                                                                          \
-        return Manager::process<lang, op, cnt, ret>(#name, p0, p1);            \
+        return Manager::process<lang, op, cnt, ret>(name##_target, p0, p1);    \
     }
 
 #define DEFINE_FUNC3(lang, op, cnt, ret, name, t0, t1, t2)                     \
+    DECLARE_TARGET(ret, name, t0, t1, t2)                                      \
     ret name(t0 p0, t1 p1, t2 p2)                                              \
     {                                                                          \
-        return Manager::process<lang, op, cnt, ret>(#name, p0, p1, p2);        \
+        return Manager::process<lang, op, cnt, ret>(                           \
+                name##_target, p0, p1, p2);                                    \
     }
 
 #define DEFINE_FUNC4(lang, op, cnt, ret, name, t0, t1, t2, t3)                 \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3)                                  \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3)                                       \
     {                                                                          \
-        return Manager::process<lang, op, cnt, ret>(#name, p0, p1, p2, p3);    \
+        return Manager::process<lang, op, cnt, ret>(                           \
+                name##_target, p0, p1, p2, p3);                                \
     }
 
 #define DEFINE_FUNC5(lang, op, cnt, ret, name, t0, t1, t2, t3, t4)             \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4)                              \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4)                                \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4);                                    \
+                name##_target, p0, p1, p2, p3, p4);                            \
     }
 
 #define DEFINE_FUNC6(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5)         \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5)                          \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5)                         \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5);                                \
+                name##_target, p0, p1, p2, p3, p4, p5);                        \
     }
 
 #define DEFINE_FUNC7(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6)     \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6)                      \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6)                  \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5, p6);                            \
+                name##_target, p0, p1, p2, p3, p4, p5, p6);                    \
     }
 
 #define DEFINE_FUNC8(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6, t7) \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6, t7)                  \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7)           \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5, p6, p7);                        \
+                name##_target, p0, p1, p2, p3, p4, p5, p6, p7);                \
     }
 
 #define DEFINE_FUNC9(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6, t7, \
                      t8)                                                       \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6, t7, t8)              \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8)    \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5, p6, p7, p8);                    \
+                name##_target, p0, p1, p2, p3, p4, p5, p6, p7, p8);            \
     }
 
 #define DEFINE_FUNC10(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6,    \
                       t7, t8, t9)                                              \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9)          \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8,    \
              t9 p9)                                                            \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9);                \
+                name##_target, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9);        \
     }
 
 #define DEFINE_FUNC11(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6,    \
                       t7, t8, t9, t10)                                         \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10)     \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8,    \
              t9 p9, t10 p10)                                                   \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);           \
+                name##_target, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);   \
     }
 
 #define DEFINE_FUNC12(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6,    \
                       t7, t8, t9, t10, t11)                                    \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10,     \
+                   t11)                                                        \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8,    \
              t9 p9, t10 p10, t11 p11)                                          \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);      \
+                name##_target, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10,    \
+                p11);                                                          \
     }
 
 #define DEFINE_FUNC13(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6,    \
                       t7, t8, t9, t10, t11, t12)                               \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10,     \
+                   t11, t12)                                                   \
     ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8,    \
              t9 p9, t10 p10, t11 p11, t12 p12)                                 \
     {                                                                          \
         return Manager::process<lang, op, cnt, ret>(                           \
-                #name, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12); \
+                name##_target, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10,    \
+                p11, p12);                                                     \
+    }
+
+#define DEFINE_FUNC14(lang, op, cnt, ret, name, t0, t1, t2, t3, t4, t5, t6,    \
+                      t7, t8, t9, t10, t11, t12, t13)                          \
+    DECLARE_TARGET(ret, name, t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10,     \
+                   t11, t12, t13)                                              \
+    ret name(t0 p0, t1 p1, t2 p2, t3 p3, t4 p4, t5 p5, t6 p6, t7 p7, t8 p8,    \
+             t9 p9, t10 p10, t11 p11, t12 p12, t13 p13)                        \
+    {                                                                          \
+        return Manager::process<lang, op, cnt, ret>(                           \
+                name##_target, p0, p1, p2, p3, p4, p5, p6, p7, p8, p9, p10,    \
+                p11, p12, p13);                                                \
     }
 
 #endif // DEFINITIONS_HPP
@@ -0,0 +1,116 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <cinttypes>
+#include <cstdio>
+#include <mpi.h>
+
+#include "FileStatistics.hpp"
+#include "IOHandler.hpp"
+
+namespace sonar {
+
+bool FileStatistics::_enabled = false;
+bool FileStatistics::_finalized = false;
+thread_local FileStatistics::ThreadCounters *FileStatistics::_thread = nullptr;
+thread_local FileStatistics::Access FileStatistics::_current;
+std::vector<FileStatistics::ThreadCounters *> FileStatistics::_threads;
+std::mutex FileStatistics::_lock;
+
+FileStatistics::ThreadCounters *FileStatistics::registerThread()
+{
+    _thread = new ThreadCounters();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _threads.push_back(_thread);
+    return _thread;
+}
+
+void FileStatistics::finalize(const std::string &path)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // The C and Fortran finalization may be both intercepted
+    if (_finalized)
+        return;
+    _finalized = true;
+
+    // Merge the counters of all threads
+    Counters merged[NumOperations] = {};
+    for (ThreadCounters *thread : _threads) {
+        for (int o = 0; o < NumOperations; ++o) {
+            merged[o]._calls += thread->_counters[o]._calls;
+            merged[o]._bytes += thread->_counters[o]._bytes;
+            merged[o]._time += thread->_counters[o]._time;
+        }
+        delete thread;
+    }
+    _threads.clear();
+    _thread = nullptr;
+
+    // The sums are the ranks, calls, bytes and time of each operation. The
+    // minimums and maximums are the bytes and time of the ranks that called
+    // the operation, and the slowest rank is the one with the longest time
+    std::vector<uint64_t> sums(NumOperations * 4), mins(NumOperations * 2), maxs(NumOperations * 2);
+    struct { double _time; int _rank; } slowest[NumOperations];
+
+    int rank, nranks;
+    PMPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    PMPI_Comm_size(MPI_COMM_WORLD, &nranks);
+
+    for (int o = 0; o < NumOperations; ++o) {
+        bool called = (merged[o]._calls > 0);
+        sums[o * 4 + 0] = called;
+        sums[o * 4 + 1] = merged[o]._calls;
+        sums[o * 4 + 2] = merged[o]._bytes;
+        sums[o * 4 + 3] = merged[o]._time;
+        mins[o * 2 + 0] = called ? merged[o]._bytes : UINT64_MAX;
+        mins[o * 2 + 1] = called ? merged[o]._time : UINT64_MAX;
+        maxs[o * 2 + 0] = merged[o]._bytes;
+        maxs[o * 2 + 1] = merged[o]._time;
+        slowest[o] = { called ? (double) merged[o]._time : -1.0, rank };
+    }
+
+    // Reduce in place at rank zero
+    auto reduce = [&](void *data, int count, MPI_Datatype type, MPI_Op op) {
+        const void *send = (rank == 0) ? MPI_IN_PLACE : data;
+        return PMPI_Reduce(send, data, count, type, op, 0, MPI_COMM_WORLD) == MPI_SUCCESS;
+    };
+
+    bool failed = !reduce(sums.data(), sums.size(), MPI_UINT64_T, MPI_SUM);
+    failed |= !reduce(mins.data(), mins.size(), MPI_UINT64_T, MPI_MIN);
+    failed |= !reduce(maxs.data(), maxs.size(), MPI_UINT64_T, MPI_MAX);
+    failed |= !reduce(slowest, NumOperations, MPI_DOUBLE_INT, MPI_MAXLOC);
+    if (failed)
+        IOHandler::fail("Could not reduce the file access statistics");
+
+    if (rank != 0)
+        return;
+
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr)
+        IOHandler::fail("Could not open the file access statistics file ", path);
+
+    fprintf(file, "# Sonar MPI file access statistics of %d ranks\n", nranks);
+    fprintf(file, "# operation ranks calls bytes min_rank_bytes max_rank_bytes "
+                  "time_ns min_rank_ns max_rank_ns slowest_rank\n");
+
+    for (int o = 0; o < NumOperations; ++o) {
+        if (sums[o * 4 + 1] == 0)
+            continue;
+
+        fprintf(file, "%s %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64
+                " %" PRIu64 " %" PRIu64 " %" PRIu64 " %d\n", Operation::Names[First + o],
+                sums[o * 4 + 0], sums[o * 4 + 1], sums[o * 4 + 2], mins[o * 2 + 0],
+                maxs[o * 2 + 0], sums[o * 4 + 3], mins[o * 2 + 1], maxs[o * 2 + 1],
+                slowest[o]._rank);
+    }
+
+    if (fclose(file))
+        IOHandler::fail("Could not write the file access statistics file ", path);
+}
+
+} // namespace sonar
@@ -0,0 +1,118 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef FILE_STATISTICS_HPP
+#define FILE_STATISTICS_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Clock.hpp"
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that accumulates the statistics of the file accesses. Each thread
+//! counts the calls, bytes and time of each file access operation, and the
+//! counters of all ranks are reduced and written in a single file at
+//! finalization
+class FileStatistics {
+private:
+    //! The range of file access operations
+    static constexpr Operation::Code First = Operation::FileRead;
+    static constexpr Operation::Code Last = Operation::FileWriteOrderedEnd;
+    static constexpr int NumOperations = Last - First + 1;
+
+    //! The counters of a file access operation
+    struct Counters {
+        uint64_t _calls;
+        uint64_t _bytes;
+        uint64_t _time;
+    };
+
+    //! The counters of a thread. The counters are only read at finalization,
+    //! when no other thread can call any MPI operation
+    struct ThreadCounters {
+        Counters _counters[NumOperations];
+    };
+
+    //! The ongoing access of a thread
+    struct Access {
+        uint64_t _start;
+        uint64_t _bytes;
+    };
+
+    //! Whether the statistics are enabled
+    static bool _enabled;
+
+    //! Whether the statistics were already written
+    static bool _finalized;
+
+    //! The counters and the ongoing access of the current thread
+    static thread_local ThreadCounters *_thread;
+    static thread_local Access _current;
+
+    //! The counters of all threads and the lock protecting them
+    static std::vector<ThreadCounters *> _threads;
+    static std::mutex _lock;
+
+    //! \brief Allocate and register the counters of the current thread
+    static ThreadCounters *registerThread();
+
+public:
+    //! \brief Enable the statistics
+    static void enable()
+    {
+        _enabled = true;
+    }
+
+    //! \brief Check whether the statistics are enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Record the start of a file access
+    //!
+    //! \param bytes The size of the access in bytes
+    static void enter(uint64_t bytes)
+    {
+        _current._bytes = bytes;
+        _current._start = Clock::now();
+    }
+
+    //! \brief Record the end of the current file access
+    template <Operation::Code Code>
+    static void exit()
+    {
+        static_assert(Code >= First && Code <= Last);
+
+        uint64_t end = Clock::now();
+
+        ThreadCounters *thread = _thread;
+        if (__builtin_expect(thread == nullptr, 0))
+            thread = registerThread();
+
+        Counters &counters = thread->_counters[Code - First];
+        counters._calls += 1;
+        counters._bytes += _current._bytes;
+        counters._time += end - _current._start;
+    }
+
+    //! \brief Reduce the counters of all ranks and write the statistics
+    //!
+    //! This is a collective operation that must be called by all ranks
+    //! before the MPI finalization. Rank zero writes the file
+    //!
+    //! \param path The path of the statistics file
+    static void finalize(const std::string &path);
+};
+
+} // namespace sonar
+
+#endif // FILE_STATISTICS_HPP
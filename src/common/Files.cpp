@@ -0,0 +1,61 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include "Files.hpp"
+
+namespace sonar {
+
+bool Files::_enabled = false;
+uint32_t Files::_identifiers = 0;
+std::unordered_map<MPI_File, uint32_t> Files::_files;
+std::mutex Files::_lock;
+
+uint32_t Files::create(MPI_File file)
+{
+    if (file == MPI_FILE_NULL)
+        return 0;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    uint32_t id = ++_identifiers;
+
+    // Replace any stale entry of a file that was closed without our wrapper
+    _files[file] = id;
+    Cache::invalidate();
+    return id;
+}
+
+void Files::forget(MPI_File file)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _files.erase(file);
+    Cache::invalidate();
+}
+
+uint32_t Files::lookup(MPI_File file)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto it = _files.find(file);
+    return (it != _files.end()) ? it->second : 0;
+}
+
+int64_t Files::offset(MPI_File file, FilePointer pointer, MPI_Offset offset)
+{
+    if (pointer == FilePointer::Shared)
+        return -1;
+
+    if (pointer == FilePointer::Individual) {
+        if (PMPI_File_get_position(file, &offset) != MPI_SUCCESS)
+            return -1;
+    }
+
+    // Translate the offset relative to the view to an absolute displacement
+    MPI_Offset displacement;
+    if (PMPI_File_get_byte_offset(file, offset, &displacement) != MPI_SUCCESS)
+        return -1;
+    return displacement;
+}
+
+} // namespace sonar
@@ -0,0 +1,93 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef FILES_HPP
+#define FILES_HPP
+
+#include <cstdint>
+#include <mpi.h>
+#include <mutex>
+#include <unordered_map>
+
+#include "Arguments.hpp"
+#include "Utils.hpp"
+
+namespace sonar {
+
+//! Class that identifies the files opened with MPI-IO from their opening
+//! until they are closed. Each file gets a process-wide identifier when it is
+//! opened, so the accesses of the same file can be correlated even if its
+//! handle is reused after closing it
+class Files {
+private:
+    //! Whether the tracking is enabled
+    static bool _enabled;
+
+    //! The number of assigned identifiers
+    static uint32_t _identifiers;
+
+    //! The identifier of each file and the lock protecting them
+    static std::unordered_map<MPI_File, uint32_t> _files;
+    static std::mutex _lock;
+
+    //! The per-thread cache of identifiers, which avoids taking the lock in
+    //! the file accesses. Invalidated whenever a file is opened or closed
+    using Cache = HandleCache<Files, MPI_File, uint32_t>;
+
+    //! \brief Find the identifier of a file in the shared table
+    static uint32_t lookup(MPI_File file);
+
+public:
+    //! \brief Enable the tracking
+    static void enable()
+    {
+        _enabled = true;
+    }
+
+    //! \brief Check whether the tracking is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Record an opened file
+    //!
+    //! \returns The identifier of the file
+    static uint32_t create(MPI_File file);
+
+    //! \brief Remove a closed file
+    static void forget(MPI_File file);
+
+    //! \brief Get the identifier of a file
+    //!
+    //! The lock is only taken the first time each thread accesses the file
+    //! after the last invalidation
+    //!
+    //! \returns The identifier or zero if the file is not tracked
+    static uint32_t identifier(MPI_File file)
+    {
+        return Cache::get(file, [](MPI_File handle, uint32_t &id) {
+            id = lookup(handle);
+        });
+    }
+
+    //! \brief Get the absolute offset in bytes where an access starts
+    //!
+    //! This function must be called before the access, since the accesses
+    //! through the individual file pointer advance it. The shared file
+    //! pointer is not queried, since it requires synchronization
+    //!
+    //! \param file The file handle
+    //! \param pointer The file pointer of the access
+    //! \param offset The explicit offset in etype units if any
+    //!
+    //! \returns The offset in bytes or -1 if it is unknown
+    static int64_t offset(MPI_File file, FilePointer pointer, MPI_Offset offset);
+};
+
+} // namespace sonar
+
+#endif // FILES_HPP
@@ -0,0 +1,93 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <strings.h>
+
+#include "Filter.hpp"
+#include "IOHandler.hpp"
+
+namespace sonar {
+
+const Filter::Group Filter::Groups[] = {
+    { "all",          Operation::Wait,      Operation::Code(Operation::NumCodes - 1) },
+    { "wait",         Operation::Wait,      Operation::Waitsome },
+    { "test",         Operation::Test,      Operation::Testsome },
+    { "probe",        Operation::Probe,     Operation::Improbe },
+    { "p2p",          Operation::Recv,      Operation::Mrecv },
+    { "collectives",  Operation::Allgather, Operation::Exscan },
+    { "ip2p",         Operation::Irecv,     Operation::Imrecv },
+    { "icollectives", Operation::Iallgather, Operation::Iexscan },
+    { "persistent",   Operation::BsendInit, Operation::SsendInit },
+    { "partitioned",  Operation::PrecvInit, Operation::Parrived },
+    { "pcollectives", Operation::AllgatherInit, Operation::ExscanInit },
+    { "start",        Operation::Start,     Operation::Startall },
+    { "window",       Operation::WinAllocate, Operation::WinFree },
+    { "rma",          Operation::Accumulate, Operation::Rput },
+    { "rmasync",      Operation::WinFence,  Operation::WinSync },
+    { "file",         Operation::FileOpen,  Operation::FileSync },
+    { "io",           Operation::FileRead,  Operation::FileWriteOrdered },
+    { "iio",          Operation::FileIread, Operation::FileIwriteAtAll },
+    { "splitio",      Operation::FileReadAllBegin, Operation::FileWriteOrderedEnd },
+    { "neighbor",     Operation::NeighborAllgather, Operation::NeighborAlltoallw },
+    { "ineighbor",    Operation::IneighborAllgather, Operation::IneighborAlltoallw },
+    { "pneighbor",    Operation::NeighborAllgatherInit, Operation::NeighborAlltoallwInit },
+    { "topology",     Operation::CartCreate, Operation::DistGraphCreateAdjacent },
+    { "comm",         Operation::CommDup,   Operation::CommFree },
+};
+
+std::bitset<Operation::NumCodes> Filter::_selected;
+
+bool Filter::apply(std::bitset<Operation::NumCodes> &selected,
+                   const std::string &name, bool select)
+{
+    for (const Group &group : Groups) {
+        if (strcasecmp(name.c_str(), group._name) == 0) {
+            for (int code = group._first; code <= group._last; ++code)
+                selected[code] = select;
+            return true;
+        }
+    }
+
+    Operation::Code code = Operation::find(name.c_str());
+    if (code != Operation::NumCodes) {
+        selected[code] = select;
+        return true;
+    }
+    return false;
+}
+
+std::bitset<Operation::NumCodes> Filter::parse(const std::string &selection,
+                                               const std::string &name)
+{
+    std::bitset<Operation::NumCodes> selected;
+    std::istringstream stream(selection);
+    std::string token;
+    bool first = true;
+
+    while (std::getline(stream, token, ',')) {
+        token.erase(std::remove_if(token.begin(), token.end(), ::isspace), token.end());
+        if (token.empty())
+            continue;
+
+        bool select = (token[0] != '-');
+        if (!select)
+            token.erase(0, 1);
+
+        // Excluding operations first starts from all of them
+        if (first && !select)
+            selected.set();
+        first = false;
+
+        if (!apply(selected, token, select))
+            IOHandler::fail("Invalid operation or group ", token, " for ", name);
+    }
+    return selected;
+}
+
+} // namespace sonar
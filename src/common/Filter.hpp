@@ -0,0 +1,73 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef FILTER_HPP
+#define FILTER_HPP
+
+#include <bitset>
+#include <string>
+
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that decides which operations are instrumented by the ovni and the
+//! statistics instrumentations. The selection is a comma-separated list of
+//! operation groups and operation names, which are excluded when prefixed by
+//! a minus sign. A list starting with an exclusion selects all operations
+//! before applying it. The initialization and finalization operations are
+//! always selected
+class Filter {
+private:
+    //! A named group of consecutive operation codes
+    struct Group {
+        const char *_name;
+        Operation::Code _first;
+        Operation::Code _last;
+    };
+
+    //! The operation groups
+    static const Group Groups[];
+
+    //! The selected operations
+    static std::bitset<Operation::NumCodes> _selected;
+
+    //! \brief Select or exclude the operations of a group or an operation
+    //!
+    //! \returns Whether the name is a valid group or operation
+    static bool apply(std::bitset<Operation::NumCodes> &selected,
+                      const std::string &name, bool select);
+
+public:
+    //! \brief Parse a selection of operations
+    //!
+    //! \param selection The list of groups and operations
+    //! \param name The name of the option for the error messages
+    //!
+    //! \returns The selected operations
+    static std::bitset<Operation::NumCodes> parse(const std::string &selection,
+                                                  const std::string &name);
+
+    //! \brief Parse the selection of instrumented operations
+    //!
+    //! \param selection The list of groups and operations
+    //! \param name The name of the option for the error messages
+    static void initialize(const std::string &selection, const std::string &name)
+    {
+        _selected = parse(selection, name);
+    }
+
+    //! \brief Check whether an operation is selected
+    template <Operation::Code Operation>
+    static bool selected()
+    {
+        return Operation <= sonar::Operation::Finalize || _selected[Operation];
+    }
+};
+
+} // namespace sonar
+
+#endif // FILTER_HPP
@@ -0,0 +1,321 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <climits>
+#include <cstdio>
+#include <tuple>
+
+#include "Communicators.hpp"
+#include "IOHandler.hpp"
+#include "Imbalance.hpp"
+
+namespace sonar {
+
+bool Imbalance::_enabled = false;
+std::atomic<bool> Imbalance::_initialized(false);
+std::atomic<bool> Imbalance::_finalized(false);
+size_t Imbalance::_limit = 0;
+int Imbalance::_rank = 0;
+int Imbalance::_nranks = 1;
+MPI_Comm Imbalance::_comm = MPI_COMM_NULL;
+Imbalance::Synchronization Imbalance::_initial = {};
+std::unordered_map<int32_t, std::shared_ptr<Imbalance::Collectives>> Imbalance::_comms;
+thread_local Imbalance::ThreadRecords *Imbalance::_thread = nullptr;
+std::vector<Imbalance::ThreadRecords *> Imbalance::_threads;
+std::mutex Imbalance::_lock;
+
+Imbalance::ThreadRecords *Imbalance::registerThread()
+{
+    _thread = new ThreadRecords();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _threads.push_back(_thread);
+
+    return _thread;
+}
+
+std::shared_ptr<Imbalance::Collectives> Imbalance::identify(int32_t comm)
+{
+    MPI_Comm handle = MPI_Comm_f2c(comm);
+    auto collectives = std::make_shared<Collectives>();
+
+    int inter, size;
+    PMPI_Comm_test_inter(handle, &inter);
+    PMPI_Comm_size(handle, &size);
+    if (inter || size <= 1)
+        return collectives;
+
+    // The communicators created through the wrappers already have a
+    // job-wide identifier. Otherwise, the members derive one locally
+    uint64_t id;
+    if (!Communicators::identifier(comm, id))
+        id = Communicators::identify(handle);
+
+    collectives->_tracked = true;
+    collectives->_id = id;
+    collectives->_size = size;
+    return collectives;
+}
+
+std::shared_ptr<Imbalance::Collectives> Imbalance::lookup(int32_t comm)
+{
+    // The identification does not communicate, so it is done while holding
+    // the lock to identify each communicator once
+    std::lock_guard<std::mutex> guard(_lock);
+
+    std::shared_ptr<Collectives> &collectives = _comms[comm];
+    if (!collectives)
+        collectives = identify(comm);
+    return collectives;
+}
+
+bool Imbalance::start(Operation::Code operation, int32_t comm, Record &record)
+{
+    // The calls before the initialization cannot be analyzed
+    if (!_initialized.load(std::memory_order_relaxed) || _finalized.load(std::memory_order_relaxed))
+        return false;
+
+    Collectives &collectives = Imbalance::collectives(comm);
+    if (!collectives._tracked)
+        return false;
+
+    // The sequence number advances even if the call is not recorded, so the
+    // next calls still match the ones of the other ranks
+    uint64_t sequence = collectives._sequence.fetch_add(1, std::memory_order_relaxed);
+    if (_thread->_records.size() >= _limit)
+        return false;
+
+    record._comm = collectives._id;
+    record._sequence = sequence;
+    record._members = ((uint64_t) collectives._size << 32) | (uint32_t) _rank;
+    record._operation = operation;
+    return true;
+}
+
+Imbalance::Synchronization Imbalance::synchronize()
+{
+    // The number of round trips with the parent rank. The offset is taken
+    // from the round trip with the lowest latency
+    constexpr int Samples = 16;
+
+    // The ranks form a binomial tree rooted at the first rank. Each rank
+    // measures its offset to its parent and adds the offset of the parent to
+    // the first rank, so the pairs of each level are synchronized in parallel
+    // and the latency grows logarithmically with the number of ranks
+    int64_t offset = 0;
+
+    int distance = 1;
+    while (distance < _nranks)
+        distance <<= 1;
+
+    for (distance >>= 1; distance > 0; distance >>= 1) {
+        if (_rank % (2 * distance) == 0) {
+            int child = _rank + distance;
+            if (child >= _nranks)
+                continue;
+
+            for (int s = 0; s < Samples; ++s) {
+                PMPI_Recv(nullptr, 0, MPI_BYTE, child, 0, _comm, MPI_STATUS_IGNORE);
+                int64_t time = Clock::now();
+                PMPI_Send(&time, 1, MPI_INT64_T, child, 0, _comm);
+            }
+            PMPI_Send(&offset, 1, MPI_INT64_T, child, 0, _comm);
+        } else if (_rank % (2 * distance) == distance) {
+            int parent = _rank - distance;
+            int64_t best = INT64_MAX;
+            int64_t local = 0;
+
+            for (int s = 0; s < Samples; ++s) {
+                int64_t remote;
+                int64_t start = Clock::now();
+                PMPI_Send(nullptr, 0, MPI_BYTE, parent, 0, _comm);
+                PMPI_Recv(&remote, 1, MPI_INT64_T, parent, 0, _comm, MPI_STATUS_IGNORE);
+                int64_t end = Clock::now();
+
+                if (end - start < best) {
+                    best = end - start;
+                    local = remote - (start + (end - start) / 2);
+                }
+            }
+
+            int64_t inherited;
+            PMPI_Recv(&inherited, 1, MPI_INT64_T, parent, 0, _comm, MPI_STATUS_IGNORE);
+            offset = local + inherited;
+        }
+    }
+
+    return { (int64_t) Clock::now(), offset };
+}
+
+void Imbalance::initialize(int rank, int nranks)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // The C and Fortran initialization may be both intercepted
+    if (_initialized)
+        return;
+
+    _rank = rank;
+    _nranks = nranks;
+
+    if (PMPI_Comm_dup(MPI_COMM_WORLD, &_comm) != MPI_SUCCESS)
+        IOHandler::fail("Could not duplicate the world communicator");
+
+    _initial = synchronize();
+    _initialized = true;
+}
+
+void Imbalance::finalize(const std::string &path)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // The C and Fortran finalization may be both intercepted
+    if (_finalized || !_initialized)
+        return;
+    _finalized = true;
+
+    // Convert the times to the clock of the first rank, interpolating the
+    // offsets measured at initialization and finalization to compensate
+    // the clock drift
+    Synchronization final = synchronize();
+    double drift = 0.0;
+    if (final._time > _initial._time)
+        drift = (double) (final._offset - _initial._offset) / (final._time - _initial._time);
+
+    auto convert = [&](uint64_t time) -> uint64_t {
+        int64_t elapsed = (int64_t) time - _initial._time;
+        return time + _initial._offset + (int64_t) (drift * elapsed);
+    };
+
+    // Distribute the records among the ranks by collective instance, so each
+    // instance is analyzed by a single rank
+    std::vector<std::vector<Record>> buckets(_nranks);
+    for (ThreadRecords *thread : _threads) {
+        for (Record record : thread->_records) {
+            record._entry = convert(record._entry);
+            record._exit = convert(record._exit);
+
+            uint64_t hash = (record._comm ^ record._sequence) * 0x9E3779B97F4A7C15ULL;
+            buckets[(hash >> 32) % _nranks].push_back(record);
+        }
+        delete thread;
+    }
+    _threads.clear();
+    _thread = nullptr;
+
+    std::vector<Record> sent;
+    std::vector<int> sendCounts(_nranks), sendDispls(_nranks);
+    for (int r = 0; r < _nranks; ++r) {
+        sendDispls[r] = sent.size() * Fields;
+        sendCounts[r] = buckets[r].size() * Fields;
+        sent.insert(sent.end(), buckets[r].begin(), buckets[r].end());
+    }
+    buckets.clear();
+
+    std::vector<int> recvCounts(_nranks), recvDispls(_nranks);
+    if (PMPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT,
+                      _comm) != MPI_SUCCESS)
+        IOHandler::fail("Could not exchange the collective records");
+
+    for (int r = 1; r < _nranks; ++r)
+        recvDispls[r] = recvDispls[r - 1] + recvCounts[r - 1];
+
+    std::vector<Record> records((recvDispls.back() + recvCounts.back()) / Fields);
+    if (PMPI_Alltoallv(sent.data(), sendCounts.data(), sendDispls.data(), MPI_UINT64_T,
+                       records.data(), recvCounts.data(), recvDispls.data(), MPI_UINT64_T,
+                       _comm) != MPI_SUCCESS)
+        IOHandler::fail("Could not exchange the collective records");
+    sent.clear();
+
+    // The counters of each rank, each operation and the incomplete instances
+    // are reduced in a single array
+    enum { Calls, Time, Wait, Last, Delay, RankCounters };
+    enum { Instances, OperationTime, OperationWait, OperationCounters };
+
+    const size_t operationBase = (size_t) _nranks * RankCounters;
+    const size_t incomplete = operationBase + Operation::NumCodes * OperationCounters;
+    std::vector<uint64_t> counters(incomplete + 1, 0);
+
+    std::sort(records.begin(), records.end(), [](const Record &a, const Record &b) {
+        return std::tie(a._comm, a._sequence) < std::tie(b._comm, b._sequence);
+    });
+
+    for (size_t begin = 0, end; begin < records.size(); begin = end) {
+        end = begin + 1;
+        while (end < records.size() && records[end]._comm == records[begin]._comm
+                && records[end]._sequence == records[begin]._sequence)
+            ++end;
+
+        // Instances missing the records of some members cannot be analyzed
+        if (end - begin != (records[begin]._members >> 32)) {
+            counters[incomplete] += 1;
+            continue;
+        }
+
+        auto [first, last] = std::minmax_element(records.begin() + begin, records.begin() + end,
+            [](const Record &a, const Record &b) { return (int64_t) (a._entry - b._entry) < 0; });
+
+        uint64_t *operation = &counters[operationBase + records[begin]._operation * OperationCounters];
+        operation[Instances] += 1;
+
+        for (size_t r = begin; r < end; ++r) {
+            const Record &record = records[r];
+            int64_t time = std::max<int64_t>(record._exit - record._entry, 0);
+            int64_t wait = std::clamp<int64_t>(last->_entry - record._entry, 0, time);
+
+            uint64_t *rank = &counters[(uint32_t) record._members * RankCounters];
+            rank[Calls] += 1;
+            rank[Time] += time;
+            rank[Wait] += wait;
+            rank[Delay] += record._entry - first->_entry;
+            operation[OperationTime] += time;
+            operation[OperationWait] += wait;
+        }
+        counters[(uint32_t) last->_members * RankCounters + Last] += 1;
+    }
+
+    std::vector<uint64_t> totals((_rank == 0) ? counters.size() : 0);
+    if (PMPI_Reduce(counters.data(), totals.data(), counters.size(), MPI_UINT64_T,
+                    MPI_SUM, 0, _comm) != MPI_SUCCESS)
+        IOHandler::fail("Could not reduce the collective imbalance");
+
+    PMPI_Comm_free(&_comm);
+
+    if (_rank != 0)
+        return;
+
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr)
+        IOHandler::fail("Could not open the collective imbalance file ", path);
+
+    fprintf(file, "# Sonar MPI collective load imbalance of %d ranks\n", _nranks);
+    if (totals[incomplete])
+        fprintf(file, "# %" PRIu64 " incomplete instances were not analyzed\n", totals[incomplete]);
+
+    fprintf(file, "# operation instances time_ns wait_ns\n");
+    for (int code = 0; code < Operation::NumCodes; ++code) {
+        const uint64_t *operation = &totals[operationBase + code * OperationCounters];
+        if (operation[Instances] == 0)
+            continue;
+
+        fprintf(file, "%s %" PRIu64 " %" PRIu64 " %" PRIu64 "\n", Operation::Names[code],
+                operation[Instances], operation[OperationTime], operation[OperationWait]);
+    }
+
+    fprintf(file, "# rank collectives time_ns wait_ns last delay_ns\n");
+    for (int r = 0; r < _nranks; ++r) {
+        const uint64_t *rank = &totals[r * RankCounters];
+        fprintf(file, "%d %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 "\n", r,
+                rank[Calls], rank[Time], rank[Wait], rank[Last], rank[Delay]);
+    }
+
+    if (fclose(file))
+        IOHandler::fail("Could not write the collective imbalance file ", path);
+}
+
+} // namespace sonar
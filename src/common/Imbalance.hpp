@@ -0,0 +1,218 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef IMBALANCE_HPP
+#define IMBALANCE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mpi.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Clock.hpp"
+#include "Operation.hpp"
+#include "Utils.hpp"
+
+namespace sonar {
+
+//! Class that measures the load imbalance of the blocking collectives. Each
+//! rank records the entry and exit times of its collective calls, which are
+//! identified by a job-wide communicator identifier and the sequence number
+//! of the call in the communicator. At finalization, the calls of the same
+//! collective instance are grouped across ranks to compute the time that each
+//! rank waited for the last arrival and which ranks arrived late
+class Imbalance {
+private:
+    //! A collective call of the current rank. All fields are transferred as
+    //! unsigned 64-bit integers. The times are converted to the clock of the
+    //! first rank at finalization
+    struct Record {
+        //! The job-wide communicator identifier
+        uint64_t _comm;
+        //! The sequence number of the collective in the communicator
+        uint64_t _sequence;
+        //! The entry and exit times
+        uint64_t _entry;
+        uint64_t _exit;
+        //! The communicator size in the upper half and the world rank in
+        //! the lower half
+        uint64_t _members;
+        //! The operation code
+        uint64_t _operation;
+    };
+
+    //! The number of integers of a record
+    static constexpr int Fields = sizeof(Record) / sizeof(uint64_t);
+
+    //! The collective state of a communicator. Communicators without other
+    //! members and intercommunicators are not tracked. The sequence is shared
+    //! by all threads, since they may call collectives in the same
+    //! communicator one after the other
+    struct Collectives {
+        bool _tracked;
+        uint64_t _id;
+        uint32_t _size;
+        std::atomic<uint64_t> _sequence;
+    };
+
+    //! The records of a thread and its ongoing collective call
+    struct ThreadRecords {
+        std::vector<Record> _records;
+        Record _current;
+        bool _active;
+    };
+
+    //! The offset of the local clock to the clock of the first rank measured
+    //! at a given local time
+    struct Synchronization {
+        int64_t _time;
+        int64_t _offset;
+    };
+
+    //! Whether the analysis is enabled
+    static bool _enabled;
+
+    //! Whether the analysis was initialized and finalized
+    static std::atomic<bool> _initialized;
+    static std::atomic<bool> _finalized;
+
+    //! The maximum number of records of each thread
+    static size_t _limit;
+
+    //! The world rank and number of ranks
+    static int _rank;
+    static int _nranks;
+
+    //! The private duplicate of the world communicator
+    static MPI_Comm _comm;
+
+    //! The clock synchronization at initialization
+    static Synchronization _initial;
+
+    //! The collective state of the communicators, indexed by identifier
+    static std::unordered_map<int32_t, std::shared_ptr<Collectives>> _comms;
+
+    //! The per-thread cache of collective states, which avoids taking the
+    //! lock in the collective calls
+    using Cache = HandleCache<Imbalance, int32_t, std::shared_ptr<Collectives>>;
+
+    //! The records of the current thread
+    static thread_local ThreadRecords *_thread;
+
+    //! The records of all threads and the lock protecting them and the
+    //! collective state of the communicators
+    static std::vector<ThreadRecords *> _threads;
+    static std::mutex _lock;
+
+    //! \brief Allocate and register the records of the current thread
+    static ThreadRecords *registerThread();
+
+    //! \brief Create the collective state of a communicator
+    //!
+    //! The communicators without a job-wide identifier are identified locally
+    //! by all members at their first collective call in the communicator
+    static std::shared_ptr<Collectives> identify(int32_t comm);
+
+    //! \brief Get the collective state of a communicator
+    //!
+    //! The lock is only taken the first time each thread uses the
+    //! communicator after the last invalidation
+    static Collectives &collectives(int32_t comm)
+    {
+        return *Cache::get(comm, [](int32_t id, std::shared_ptr<Collectives> &collectives) {
+            collectives = lookup(id);
+        });
+    }
+
+    //! \brief Find or create the shared collective state of a communicator
+    static std::shared_ptr<Collectives> lookup(int32_t comm);
+
+    //! \brief Start the collective call of the current thread
+    //!
+    //! \returns Whether the collective call is recorded
+    static bool start(Operation::Code operation, int32_t comm, Record &record);
+
+    //! \brief Measure the offset of the local clock to the first rank
+    //!
+    //! This is a collective operation over the world communicator. Each rank
+    //! measures its offset to its parent in a binomial tree rooted at the
+    //! first rank
+    static Synchronization synchronize();
+
+public:
+    //! \brief Enable the analysis
+    //!
+    //! \param limit The maximum number of records of each thread
+    static void enable(size_t limit)
+    {
+        _enabled = true;
+        _limit = limit;
+    }
+
+    //! \brief Check whether the analysis is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Initialize the analysis after the MPI initialization
+    //!
+    //! This is a collective operation over the world communicator
+    static void initialize(int rank, int nranks);
+
+    //! \brief Enter a blocking collective call
+    //!
+    //! \param operation The operation code
+    //! \param comm The communicator identifier
+    static void enter(Operation::Code operation, int32_t comm)
+    {
+        ThreadRecords *thread = _thread;
+        if (__builtin_expect(thread == nullptr, 0))
+            thread = registerThread();
+
+        thread->_active = start(operation, comm, thread->_current);
+        if (thread->_active)
+            thread->_current._entry = Clock::now();
+    }
+
+    //! \brief Exit the blocking collective call of the current thread
+    static void exit()
+    {
+        ThreadRecords *thread = _thread;
+        if (thread->_active) {
+            thread->_current._exit = Clock::now();
+            thread->_records.push_back(thread->_current);
+            thread->_active = false;
+        }
+    }
+
+    //! \brief Forget the collective state of a freed communicator
+    //!
+    //! \param comm The communicator identifier
+    static void release(int32_t comm)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _comms.erase(comm);
+        Cache::invalidate();
+    }
+
+    //! \brief Analyze the collective calls of all ranks and write the report
+    //!
+    //! This is a collective operation that must be called by all ranks
+    //! before the MPI finalization. Rank zero writes the file
+    //!
+    //! \param path The path of the report file
+    static void finalize(const std::string &path);
+};
+
+} // namespace sonar
+
+#endif // IMBALANCE_HPP
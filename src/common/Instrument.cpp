@@ -4,11 +4,153 @@
     Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
 */
 
+#include <cstdlib>
+
 #include "Instrument.hpp"
 
 namespace sonar {
 
+bool Instrument::_enabled = false;
+bool Instrument::_rebind = false;
 bool Instrument::_ovniEnabled = false;
 bool Instrument::_ovniFinalize = false;
+bool Instrument::_statsEnabled = false;
+bool Instrument::_coalescePolling = false;
+bool Instrument::_pcontrol = true;
+uint64_t Instrument::_fuseThreshold = 0;
+int Instrument::_verbosity = Instrument::States;
+
+// Use an invalid Fortran handle so the first communicator is always reported
+thread_local int32_t Instrument::_lastComm = -1;
+
+// Use an invalid identifier so the first file is always reported
+thread_local uint32_t Instrument::_lastFile = UINT32_MAX;
+
+thread_local Instrument::PollingState Instrument::_polling;
+
+thread_local bool Instrument::_ovniThreadReady = false;
+
+size_t Instrument::_ovniLazyThreads = 0;
+bool Instrument::_ovniFinalized = false;
+bool Instrument::_ovniFinalizeDeferred = false;
+std::mutex Instrument::_ovniLock;
+
+struct Instrument::ThreadFinalizer {
+    //! Whether the ovni thread was initialized lazily
+    bool _owned = false;
+
+    ~ThreadFinalizer()
+    {
+        if (!_owned)
+            return;
+
+        std::lock_guard<std::mutex> guard(Instrument::_ovniLock);
+
+        // The process may have been finalized at the program exit while the
+        // thread was still alive
+        if (ovni_proc_isready() && ovni_thread_isready())
+            Instrument::ovniThreadFinalize();
+
+        // The last lazily initialized thread finalizes the deferred process
+        if (--Instrument::_ovniLazyThreads == 0 && Instrument::_ovniFinalizeDeferred)
+            Instrument::ovniProcessFinalize();
+    }
+};
+
+thread_local Instrument::ThreadFinalizer Instrument::_ovniThreadFinalizer;
+
+bool Instrument::ovniThreadInitialize()
+{
+    std::lock_guard<std::mutex> guard(_ovniLock);
+
+    // The calls before the MPI initialization or after the finalization
+    // cannot be traced
+    if (_ovniFinalized || !ovni_proc_isready())
+        return false;
+
+    if (!ovni_thread_isready()) {
+        ovni_thread_init(gettid());
+
+        // Emit the ovni thread executing event on any CPU
+        emit<int32_t, int32_t, uint64_t>("OHx", -1, -1, 0);
+
+        // Mark the trace of the thread as sampled with its initial period
+        if (Sampler::enabled())
+            emit<uint64_t>("MXs", Sampler::period());
+
+        _ovniThreadFinalizer._owned = true;
+        ++_ovniLazyThreads;
+    }
+    _ovniThreadReady = true;
+
+    return true;
+}
+
+void Instrument::ovniThreadFinalize()
+{
+    finishPolling();
+
+    // Emit the ovni thread end event and flush
+    emit("OHe");
+    ovni_flush();
+    ovni_thread_free();
+
+    _ovniThreadReady = false;
+}
+
+void Instrument::ovniProcessFinalize()
+{
+    _ovniFinalizeDeferred = false;
+    ovni_proc_fini();
+}
+
+void Instrument::ovniExit()
+{
+    std::lock_guard<std::mutex> guard(_ovniLock);
+    if (!_ovniFinalizeDeferred)
+        return;
+
+    // The streams of the threads still alive, such as the workers of a
+    // thread pool, can only be flushed by themselves
+    IOHandler::warn(_ovniLazyThreads, " threads that traced calls are alive at the program "
+                    "exit; the end of their traces is lost");
+    ovniProcessFinalize();
+}
+
+void Instrument::ovniFinalize()
+{
+    std::lock_guard<std::mutex> guard(_ovniLock);
+
+    // The C and Fortran finalization may be both intercepted
+    if (_ovniFinalized)
+        return;
+    _ovniFinalized = true;
+
+    if (_ovniThreadFinalizer._owned) {
+        // The current thread was initialized lazily, so it is finalized now
+        // instead of at its exit
+        ovniThreadFinalize();
+        _ovniThreadFinalizer._owned = false;
+        --_ovniLazyThreads;
+    } else if (_ovniFinalize) {
+        // Emit the ovni thread end event and flush
+        emit("OHe");
+        ovni_flush();
+    }
+    _ovniThreadReady = false;
+
+    if (!_ovniFinalize)
+        return;
+
+    // Finalize the ovni process, or let the last lazily initialized thread
+    // finalize it. Finalize it at the program exit anyway, in case some
+    // threads never exit
+    if (_ovniLazyThreads == 0) {
+        ovni_proc_fini();
+    } else {
+        _ovniFinalizeDeferred = true;
+        std::atexit(ovniExit);
+    }
+}
 
 } // namespace sonar
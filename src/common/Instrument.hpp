@@ -7,20 +7,50 @@
 #ifndef INSTRUMENT_HPP
 #define INSTRUMENT_HPP
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <mutex>
 #include <ovni.h>
 #include <unistd.h>
 #include <unordered_set>
+#include <vector>
 
+#include "Clock.hpp"
+#include "Communicators.hpp"
 #include "Compat.hpp"
 #include "Envar.hpp"
+#include "FileStatistics.hpp"
+#include "Files.hpp"
+#include "Filter.hpp"
 #include "IOHandler.hpp"
+#include "Imbalance.hpp"
+#include "Matrix.hpp"
 #include "Operation.hpp"
+#include "Persistent.hpp"
+#include "Pvars.hpp"
+#include "Requests.hpp"
+#include "Rma.hpp"
+#include "Sampler.hpp"
+#include "Statistics.hpp"
+#include "Topology.hpp"
 #include "Utils.hpp"
+#include "Window.hpp"
 
 namespace sonar {
 
 class Instrument {
+public:
+    //! The verbosity levels of the instrumentation. Each level includes the
+    //! events of the previous ones
+    enum Verbosity {
+        //! Only the enter and exit events of the operations
+        States = 0,
+        //! The information of the point-to-point messages, the RMA accesses
+        //! and synchronizations, and the file accesses
+        Messages,
+    };
+
 private:
     //! The state is composed by the enter and exit ovni MCV, which are three
     //! characters that specify the event model, category and value. There is
@@ -49,6 +79,11 @@ private:
         [Operation::Testall]             = { "MTa", "MTA", false },
         [Operation::Testany]             = { "MTy", "MTY", false },
         [Operation::Testsome]            = { "MTs", "MTS", false },
+        //! Probing messages
+        [Operation::Probe]               = { "MB[", "MB]", false },
+        [Operation::Iprobe]              = { "Mb[", "Mb]", false },
+        [Operation::Mprobe]              = { "MBm", "MBM", false },
+        [Operation::Improbe]             = { "Mbm", "MbM", false },
         //! Blocking primitives
         [Operation::Recv]                = { "MR[", "MR]", false },
         [Operation::Send]                = { "MS[", "MS]", false },
@@ -57,6 +92,7 @@ private:
         [Operation::Ssend]               = { "MSs", "MSS", false },
         [Operation::Sendrecv]            = { "MRs", "MRS", false },
         [Operation::SendrecvReplace]     = { "MRo", "MRO", false },
+        [Operation::Mrecv]               = { "MRm", "MRM", false },
         //! Blocking collectives
         [Operation::Allgather]           = { "MAg", "MAG", false },
         [Operation::Allgatherv]          = { "MAg", "MAG", true  },
@@ -83,6 +119,7 @@ private:
         [Operation::Issend]              = { "Mss", "MsS", false },
         [Operation::Isendrecv]           = { "Mrs", "MrS", false },
         [Operation::IsendrecvReplace]    = { "Mro", "MrO", false },
+        [Operation::Imrecv]              = { "Mrm", "MrM", false },
         //! Non-blocking collectives
         [Operation::Iallgather]          = { "Mag", "MaG", false },
         [Operation::Iallgatherv]         = { "Mag", "MaG", true  },
@@ -101,20 +138,281 @@ private:
         [Operation::Iscatterv]           = { "Mds", "MdS", true  },
         [Operation::Iscan]               = { "Mcs", "McS", false },
         [Operation::Iexscan]             = { "Mce", "McE", false },
+        //! Persistent primitives
+        [Operation::BsendInit]           = { "MIb", "MIB", false },
+        [Operation::RecvInit]            = { "MIv", "MIV", false },
+        [Operation::RsendInit]           = { "MIr", "MIR", false },
+        [Operation::SendInit]            = { "MIs", "MIS", false },
+        [Operation::SsendInit]           = { "MIy", "MIY", false },
+        //! Partitioned primitives
+        [Operation::PrecvInit]           = { "MQv", "MQV", false },
+        [Operation::PsendInit]           = { "MQs", "MQS", false },
+        [Operation::Pready]              = { "MQ[", "MQ]", false },
+        [Operation::PreadyRange]         = { "MQr", "MQR", false },
+        [Operation::PreadyList]          = { "MQl", "MQL", false },
+        [Operation::Parrived]            = { "MQa", "MQA", false },
+        //! Persistent collectives
+        [Operation::AllgatherInit]       = { "MGg", "MGG", false },
+        [Operation::AllgathervInit]      = { "MGg", "MGG", true  },
+        [Operation::AllreduceInit]       = { "MGr", "MGR", false },
+        [Operation::AlltoallInit]        = { "MGa", "MGA", false },
+        [Operation::AlltoallvInit]       = { "MGa", "MGA", true  },
+        [Operation::AlltoallwInit]       = { "MGa", "MGA", true  },
+        [Operation::BarrierInit]         = { "MGb", "MGB", false },
+        [Operation::BcastInit]           = { "MGd", "MGD", false },
+        [Operation::GatherInit]          = { "MGt", "MGT", false },
+        [Operation::GathervInit]         = { "MGt", "MGT", true  },
+        [Operation::ReduceInit]          = { "MGe", "MGE", false },
+        [Operation::ReduceScatterInit]   = { "MGs", "MGS", false },
+        [Operation::ReduceScatterBlockInit] = { "MGk", "MGK", false },
+        [Operation::ScatterInit]         = { "MGc", "MGC", false },
+        [Operation::ScattervInit]        = { "MGc", "MGC", true  },
+        [Operation::ScanInit]            = { "MGn", "MGN", false },
+        [Operation::ExscanInit]          = { "MGx", "MGX", false },
+        //! Starting persistent requests
+        [Operation::Start]               = { "MY[", "MY]", false },
+        [Operation::Startall]            = { "MYa", "MYA", false },
+        //! Creating and freeing RMA windows
+        [Operation::WinAllocate]         = { "MNa", "MNA", false },
+        [Operation::WinAllocateShared]   = { "MNs", "MNS", false },
+        [Operation::WinCreate]           = { "MNc", "MNC", false },
+        [Operation::WinCreateDynamic]    = { "MNd", "MND", false },
+        [Operation::WinFree]             = { "MNf", "MNF", false },
+        //! RMA communication
+        [Operation::Accumulate]          = { "MOa", "MOA", false },
+        [Operation::CompareAndSwap]      = { "MOc", "MOC", false },
+        [Operation::FetchAndOp]          = { "MOf", "MOF", false },
+        [Operation::Get]                 = { "MOg", "MOG", false },
+        [Operation::GetAccumulate]       = { "MOx", "MOX", false },
+        [Operation::Put]                 = { "MOp", "MOP", false },
+        //! Request-based RMA communication
+        [Operation::Raccumulate]         = { "Moa", "MoA", false },
+        [Operation::Rget]                = { "Mog", "MoG", false },
+        [Operation::RgetAccumulate]      = { "Mox", "MoX", false },
+        [Operation::Rput]                = { "Mop", "MoP", false },
+        //! RMA active target synchronization
+        [Operation::WinFence]            = { "MKf", "MKF", false },
+        [Operation::WinPost]             = { "MKp", "MKP", false },
+        [Operation::WinStart]            = { "MKs", "MKS", false },
+        [Operation::WinComplete]         = { "MKc", "MKC", false },
+        [Operation::WinWait]             = { "MKw", "MKW", false },
+        [Operation::WinTest]             = { "MKt", "MKT", false },
+        //! RMA passive target synchronization
+        [Operation::WinLock]             = { "MLl", "MLL", false },
+        [Operation::WinUnlock]           = { "MLu", "MLU", false },
+        [Operation::WinLockAll]          = { "MLa", "MLA", false },
+        [Operation::WinUnlockAll]        = { "MLn", "MLN", false },
+        [Operation::WinFlush]            = { "MLf", "MLF", false },
+        [Operation::WinFlushAll]         = { "MLg", "MLG", false },
+        [Operation::WinFlushLocal]       = { "MLo", "MLO", false },
+        [Operation::WinFlushLocalAll]    = { "MLp", "MLP", false },
+        [Operation::WinSync]             = { "MLs", "MLS", false },
+        //! Opening and managing files
+        [Operation::FileOpen]            = { "MHo", "MHO", false },
+        [Operation::FileClose]           = { "MHc", "MHC", false },
+        [Operation::FileSetView]         = { "MHv", "MHV", false },
+        [Operation::FileSync]            = { "MHs", "MHS", false },
+        //! Independent file accesses
+        [Operation::FileRead]            = { "MVr", "MVR", false },
+        [Operation::FileReadAt]          = { "MVa", "MVA", false },
+        [Operation::FileReadShared]      = { "MVs", "MVS", false },
+        [Operation::FileWrite]           = { "MVw", "MVW", false },
+        [Operation::FileWriteAt]         = { "MVt", "MVT", false },
+        [Operation::FileWriteShared]     = { "MVh", "MVH", false },
+        //! Collective file accesses
+        [Operation::FileReadAll]         = { "MZr", "MZR", false },
+        [Operation::FileReadAtAll]       = { "MZa", "MZA", false },
+        [Operation::FileReadOrdered]     = { "MZo", "MZO", false },
+        [Operation::FileWriteAll]        = { "MZw", "MZW", false },
+        [Operation::FileWriteAtAll]      = { "MZt", "MZT", false },
+        [Operation::FileWriteOrdered]    = { "MZp", "MZP", false },
+        //! Non-blocking file accesses
+        [Operation::FileIread]           = { "Mvr", "MvR", false },
+        [Operation::FileIreadAt]         = { "Mva", "MvA", false },
+        [Operation::FileIreadShared]     = { "Mvs", "MvS", false },
+        [Operation::FileIwrite]          = { "Mvw", "MvW", false },
+        [Operation::FileIwriteAt]        = { "Mvt", "MvT", false },
+        [Operation::FileIwriteShared]    = { "Mvh", "MvH", false },
+        [Operation::FileIreadAll]        = { "Mvl", "MvL", false },
+        [Operation::FileIreadAtAll]      = { "Mvm", "MvM", false },
+        [Operation::FileIwriteAll]       = { "Mvx", "MvX", false },
+        [Operation::FileIwriteAtAll]     = { "Mvy", "MvY", false },
+        //! Split collective file accesses
+        [Operation::FileReadAllBegin]    = { "Mzr", "MzR", false },
+        [Operation::FileReadAllEnd]      = { "Mze", "MzE", false },
+        [Operation::FileReadAtAllBegin]  = { "Mza", "MzA", false },
+        [Operation::FileReadAtAllEnd]    = { "Mzb", "MzB", false },
+        [Operation::FileReadOrderedBegin] = { "Mzo", "MzO", false },
+        [Operation::FileReadOrderedEnd]  = { "Mzp", "MzP", false },
+        [Operation::FileWriteAllBegin]   = { "Mzw", "MzW", false },
+        [Operation::FileWriteAllEnd]     = { "Mzx", "MzX", false },
+        [Operation::FileWriteAtAllBegin] = { "Mzt", "MzT", false },
+        [Operation::FileWriteAtAllEnd]   = { "Mzu", "MzU", false },
+        [Operation::FileWriteOrderedBegin] = { "Mzq", "MzQ", false },
+        [Operation::FileWriteOrderedEnd] = { "Mzs", "MzS", false },
+        //! Neighborhood collectives
+        [Operation::NeighborAllgather]   = { "MJg", "MJG", false },
+        [Operation::NeighborAllgatherv]  = { "MJg", "MJG", true  },
+        [Operation::NeighborAlltoall]    = { "MJa", "MJA", false },
+        [Operation::NeighborAlltoallv]   = { "MJa", "MJA", true  },
+        [Operation::NeighborAlltoallw]   = { "MJa", "MJA", true  },
+        //! Non-blocking neighborhood collectives
+        [Operation::IneighborAllgather]  = { "Mjg", "MjG", false },
+        [Operation::IneighborAllgatherv] = { "Mjg", "MjG", true  },
+        [Operation::IneighborAlltoall]   = { "Mja", "MjA", false },
+        [Operation::IneighborAlltoallv]  = { "Mja", "MjA", true  },
+        [Operation::IneighborAlltoallw]  = { "Mja", "MjA", true  },
+        //! Persistent neighborhood collectives
+        [Operation::NeighborAllgatherInit] = { "Mji", "MjI", false },
+        [Operation::NeighborAllgathervInit] = { "Mji", "MjI", true  },
+        [Operation::NeighborAlltoallInit] = { "Mjj", "MjJ", false },
+        [Operation::NeighborAlltoallvInit] = { "Mjj", "MjJ", true  },
+        [Operation::NeighborAlltoallwInit] = { "Mjj", "MjJ", true  },
+        //! Creating topology communicators
+        [Operation::CartCreate]          = { "MMc", "MMC", false },
+        [Operation::GraphCreate]         = { "MMg", "MMG", false },
+        [Operation::DistGraphCreate]     = { "MMd", "MMD", false },
+        [Operation::DistGraphCreateAdjacent] = { "MMa", "MMA", false },
+        //! Creating and freeing communicators
+        [Operation::CommDup]             = { "MMu", "MMU", false },
+        [Operation::CommSplit]           = { "MMs", "MMS", false },
+        [Operation::CommSplitType]       = { "MMt", "MMT", false },
+        [Operation::CommCreate]          = { "MMr", "MMR", false },
+        [Operation::CommCreateGroup]     = { "MMp", "MMP", false },
+        [Operation::IntercommCreate]     = { "MMi", "MMI", false },
+        [Operation::CommFree]            = { "MMf", "MMF", false },
     };
 
+    //! Whether any instrumentation is enabled
+    static bool _enabled;
+
+    //! Whether the callers are rebound to the MPI functions
+    static bool _rebind;
+
     //! Whether the ovni instrumentation is enabled
     static bool _ovniEnabled;
 
     //! Whether the process and thread should be finalized
     static bool _ovniFinalize;
 
+    //! Whether the current thread has an initialized ovni thread. Checked
+    //! before tracing any call, so the threads that did not call the MPI
+    //! initialization are initialized lazily
+    static thread_local bool _ovniThreadReady;
+
+    //! Finalizes the ovni thread of the current thread at its exit if it was
+    //! initialized lazily
+    struct ThreadFinalizer;
+
+    //! The finalizer of the current thread
+    static thread_local ThreadFinalizer _ovniThreadFinalizer;
+
+    //! The number of lazily initialized ovni threads that did not exit yet
+    static size_t _ovniLazyThreads;
+
+    //! Whether the ovni instrumentation was finalized, so no more threads
+    //! are initialized lazily
+    static bool _ovniFinalized;
+
+    //! Whether the finalization of the ovni process waits for the exit of
+    //! the lazily initialized threads
+    static bool _ovniFinalizeDeferred;
+
+    //! Protects the lazily initialized threads and the process finalization
+    static std::mutex _ovniLock;
+
+    //! Whether the in-memory statistics are enabled
+    static bool _statsEnabled;
+
+    //! The verbosity level of the instrumentation
+    static int _verbosity;
+
+    //! The last communicator reported by each thread
+    static thread_local int32_t _lastComm;
+
+    //! The last file reported by each thread
+    static thread_local uint32_t _lastFile;
+
+    //! The state of the polling run of each thread. A polling run is a
+    //! sequence of consecutive unsuccessful test and probe operations, which
+    //! are instrumented as a single polling state
+    struct PollingState {
+        //! Whether there is an ongoing polling run
+        bool _active;
+        //! The number of unsuccessful tests and probes in the run
+        uint64_t _count;
+        //! The time when the last unsuccessful test or probe finished
+        uint64_t _end;
+    };
+
+    //! Whether consecutive unsuccessful tests and probes are coalesced
+    static bool _coalescePolling;
+
+    //! Whether the MPI_Pcontrol calls control the instrumentation
+    static bool _pcontrol;
+
+    //! The polling run of each thread
+    static thread_local PollingState _polling;
+
+    //! The maximum duration of the calls that are instrumented with a single
+    //! fused event. Zero when the short calls are not fused
+    static uint64_t _fuseThreshold;
+
+    //! \brief Emit an ovni event at a given time
+    static void emitAt(uint64_t clock, const char *mcv)
+    {
+        struct ovni_ev ev = {};
+        ovni_ev_set_clock(&ev, clock);
+        ovni_ev_set_mcv(&ev, mcv);
+        ovni_ev_emit(&ev);
+    }
+
+    //! \brief Emit an ovni event with one payload value at a given time
+    template <typename A>
+    static void emitAt(uint64_t clock, const char *mcv, A a)
+    {
+        struct ovni_ev ev = {};
+        ovni_ev_set_clock(&ev, clock);
+        ovni_ev_set_mcv(&ev, mcv);
+        ovni_payload_add(&ev, (uint8_t *) &a, sizeof(a));
+        ovni_ev_emit(&ev);
+    }
+
+    //! \brief Emit an ovni event with three payload values at a given time
+    template <typename A, typename B, typename C>
+    static void emitAt(uint64_t clock, const char *mcv, A a, B b, C c)
+    {
+        struct ovni_ev ev = {};
+        ovni_ev_set_clock(&ev, clock);
+        ovni_ev_set_mcv(&ev, mcv);
+        ovni_payload_add(&ev, (uint8_t *) &a, sizeof(a));
+        ovni_payload_add(&ev, (uint8_t *) &b, sizeof(b));
+        ovni_payload_add(&ev, (uint8_t *) &c, sizeof(c));
+        ovni_ev_emit(&ev);
+    }
+
+    //! \brief Emit an ovni event with one payload value
+    template <typename A>
+    static void emit(const char *mcv, A a)
+    {
+        emitAt(Clock::now(), mcv, a);
+    }
+
     //! \brief Emit an ovni event given the event model-category-value
     static void emit(const char *mcv)
+    {
+        emitAt(Clock::now(), mcv);
+    }
+
+    //! \brief Emit an ovni event with two payload values
+    template <typename A, typename B>
+    static void emit(const char *mcv, A a, B b)
     {
         struct ovni_ev ev = {};
-        ovni_ev_set_clock(&ev, ovni_clock_now());
+        ovni_ev_set_clock(&ev, Clock::now());
         ovni_ev_set_mcv(&ev, mcv);
+        ovni_payload_add(&ev, (uint8_t *) &a, sizeof(a));
+        ovni_payload_add(&ev, (uint8_t *) &b, sizeof(b));
         ovni_ev_emit(&ev);
     }
 
@@ -123,7 +421,7 @@ private:
     static void emit(const char *mcv, A a, B b, C c)
     {
         struct ovni_ev ev = {};
-        ovni_ev_set_clock(&ev, ovni_clock_now());
+        ovni_ev_set_clock(&ev, Clock::now());
         ovni_ev_set_mcv(&ev, mcv);
         ovni_payload_add(&ev, (uint8_t *) &a, sizeof(a));
         ovni_payload_add(&ev, (uint8_t *) &b, sizeof(b));
@@ -131,6 +429,21 @@ private:
         ovni_ev_emit(&ev);
     }
 
+    //! \brief Emit an ovni jumbo event with a variable-size payload
+    static void emitJumbo(const char *mcv, const uint8_t *payload, size_t size)
+    {
+        struct ovni_ev ev = {};
+        ovni_ev_set_clock(&ev, Clock::now());
+        ovni_ev_set_mcv(&ev, mcv);
+        ovni_ev_jumbo_emit(&ev, payload, size);
+    }
+
+    //! \brief Emit an ovni jumbo event with a variable number of integers
+    static void emitJumbo(const char *mcv, const std::vector<int32_t> &payload)
+    {
+        emitJumbo(mcv, (const uint8_t *) payload.data(), payload.size() * sizeof(int32_t));
+    }
+
     //! \brief Check the run-time and compiled ovni versions are compatible
     static void ovniCheck()
     {
@@ -162,8 +475,32 @@ private:
 
             _ovniFinalize = true;
         }
+        _ovniThreadReady = true;
     }
 
+    //! \brief Initialize the ovni thread of the current thread lazily
+    //!
+    //! The ovni thread is initialized if nobody initialized it before, and
+    //! finalized when the thread exits
+    //!
+    //! \returns Whether the thread can emit events, which requires the ovni
+    //! process to be initialized and not finalized
+    static bool ovniThreadInitialize();
+
+    //! \brief Finalize the ovni thread of the current thread
+    static void ovniThreadFinalize();
+
+    //! \brief Finalize the deferred ovni process
+    //!
+    //! The lock must be held
+    static void ovniProcessFinalize();
+
+    //! \brief Finalize the deferred ovni process at the program exit
+    //!
+    //! The buffered events of the lazily initialized threads that are still
+    //! alive are lost
+    static void ovniExit();
+
     //! \brief Set the ovni process information
     static void ovniSetProcessInformation(int rank, int nranks)
     {
@@ -171,15 +508,71 @@ private:
     }
 
     //! \brief Finalize the ovni instrumentation
-    static void ovniFinalize()
+    //!
+    //! The ovni process is not finalized until the lazily initialized
+    //! threads exit, since they may still have buffered events
+    static void ovniFinalize();
+
+    //! \brief Finish the polling run of the current thread if any
+    //!
+    //! The polling state ends when the last unsuccessful test or probe
+    //! finished and reports the number of unsuccessful calls
+    static void finishPolling()
+    {
+        if (_polling._active) {
+            emitAt<uint64_t>(_polling._end, "MTP", _polling._count);
+            _polling._active = false;
+        }
+    }
+
+    //! \brief Instrument an unsuccessful test or probe when coalescing
+    //! polling runs
+    //!
+    //! \param start The time when the call started
+    static void poll(uint64_t start)
+    {
+        if (!_polling._active) {
+            emitAt(start, "MTp");
+            _polling._active = true;
+            _polling._count = 0;
+        }
+        _polling._count++;
+        _polling._end = Clock::now();
+    }
+
+    //! \brief Enter a successful test or probe when coalescing polling runs
+    //!
+    //! The call is entered once its result is known, so any polling run is
+    //! finished and the enter event is emitted at the start of the call
+    //!
+    //! \param start The time when the call started
+    template <Operation::Code Operation>
+    static void enterAt(uint64_t start)
+    {
+        finishPolling();
+        emitAt(start, Interfaces[Operation]._enterMCV);
+    }
+
+    //! \brief Instrument a call whose enter was deferred
+    //!
+    //! Calls shorter than the fuse threshold are reported by a single fused
+    //! event at their end, with the duration and the category and value of
+    //! the enter event of their state. Longer calls are reported as regular
+    //! states starting at the given time
+    //!
+    //! \param start The time when the call started
+    template <Operation::Code Operation>
+    static void complete(uint64_t start)
     {
-        if (_ovniFinalize) {
-            // Emit the ovni thread end event and flush
-            emit("OHe");
-            ovni_flush();
+        finishPolling();
 
-            // Finalize the ovni process
-            ovni_proc_fini();
+        uint64_t end = Clock::now();
+        const char *mcv = Interfaces[Operation]._enterMCV;
+        if (end - start < _fuseThreshold) {
+            emitAt<uint64_t, char, char>(end, "MFc", end - start, mcv[1], mcv[2]);
+        } else {
+            emitAt(start, mcv);
+            emitAt(end, Interfaces[Operation]._exitMCV);
         }
     }
 
@@ -225,15 +618,119 @@ public:
         Envar<std::string> instrument("SONAR_MPI_INSTRUMENT", "none");
         if (instrument.get() == "ovni")
             _ovniEnabled = true;
+        else if (instrument.get() == "stats")
+            _statsEnabled = true;
         else if (instrument.get() == "none")
             _ovniEnabled = false;
         else
             IOHandler::fail("Invalid value ", instrument.get(), " for ",
                             instrument.getName());
 
+        Envar<bool> matrix("SONAR_MPI_MATRIX", false);
+        if (matrix.get())
+            Matrix::enable();
+
+        Envar<bool> io("SONAR_MPI_IO", false);
+        if (io.get())
+            FileStatistics::enable();
+
+        Envar<bool> imbalance("SONAR_MPI_IMBALANCE", false);
+        if (imbalance.get()) {
+            Envar<size_t> limit("SONAR_MPI_IMBALANCE_LIMIT", 1 << 20);
+            Imbalance::enable(limit.get());
+        }
+
+        // The request lifecycles are reported by the ovni and statistics
+        // instrumentations
+        Envar<bool> requests("SONAR_MPI_REQUESTS", false);
+        if (requests.get() && (_ovniEnabled || _statsEnabled))
+            Requests::enable();
+
+        _enabled = _ovniEnabled || _statsEnabled || Matrix::enabled() || Imbalance::enabled()
+                || FileStatistics::enabled();
+
+        // The calls skip the wrappers when no instrumentation is enabled
+        Envar<bool> rebind("SONAR_MPI_REBIND", true);
+        _rebind = rebind.get() && !_enabled;
+
+        Envar<int> verbosity("SONAR_MPI_VERBOSITY", States);
+        if (verbosity.get() < States || verbosity.get() > Messages)
+            IOHandler::fail("Invalid value ", verbosity.get(), " for ",
+                            verbosity.getName());
+        _verbosity = verbosity.get();
+
+        Envar<std::string> filter("SONAR_MPI_FILTER", "all");
+        Filter::initialize(filter.get(), filter.getName());
+
+        // The persistent requests are tracked to report the messages and
+        // requests of their starts
+        if ((_ovniEnabled && _verbosity >= Messages) || Matrix::enabled() || Requests::enabled())
+            Persistent::enable();
+
+        // The RMA windows are identified to report their accesses and
+        // synchronizations
+        if (_ovniEnabled && _verbosity >= Messages)
+            Rma::enable();
+
+        // The files are identified to report their accesses
+        if (_ovniEnabled && _verbosity >= Messages)
+            Files::enable();
+
+        // The communicators get job-wide identifiers to correlate their
+        // messages and collectives across ranks
+        if ((_ovniEnabled && _verbosity >= Messages) || Imbalance::enabled())
+            Communicators::enable();
+
+        // The neighbors of the topology communicators are cached to report
+        // the data exchanged with each neighbor
+        if ((_ovniEnabled && _verbosity >= Messages) || Matrix::enabled())
+            Topology::enable();
+
+        // The performance variables are sampled by the ovni and statistics
+        // instrumentations
+        Envar<std::string> pvars("SONAR_MPI_PVARS", "");
+        if (_ovniEnabled || _statsEnabled) {
+            Envar<std::string> operations("SONAR_MPI_PVARS_OPERATIONS", "collectives");
+            Envar<uint64_t> period("SONAR_MPI_PVARS_PERIOD", 0);
+            Pvars::configure(pvars.get(), Filter::parse(operations.get(), operations.getName()),
+                             period.get());
+        }
+
+        Envar<bool> coalesce("SONAR_MPI_COALESCE_POLLING", false);
+        _coalescePolling = coalesce.get();
+
+        Envar<bool> pcontrol("SONAR_MPI_PCONTROL", true);
+        _pcontrol = pcontrol.get();
+
+        // The short calls are only fused when they emit no other events
+        // inside their state
+        Envar<uint64_t> fuse("SONAR_MPI_FUSE_THRESHOLD", 0);
+        if (fuse.get() && (_verbosity > States || Requests::enabled() || Pvars::requested()))
+            IOHandler::warn("Ignoring ", fuse.getName(), " since the calls emit other events");
+        else
+            _fuseThreshold = fuse.get();
+
+        // Select the source of the timestamps before taking any of them
+        Envar<std::string> clock("SONAR_MPI_CLOCK", "ovni");
+        if (clock.get() != "ovni" && clock.get() != "tsc")
+            IOHandler::fail("Invalid value ", clock.get(), " for ", clock.getName());
+        if (_enabled)
+            Clock::initialize(clock.get() == "tsc");
+
+        // The window time offsets start at this point
+        if (_ovniEnabled || _statsEnabled)
+            Window::initialize();
+
         // Initialize ovni if enabled
-        if (_ovniEnabled)
+        if (_ovniEnabled) {
+            Sampler::initialize();
+
             ovniInitialize();
+
+            // Mark the trace as sampled with the initial period
+            if (Sampler::enabled())
+                emit<uint64_t>("MXs", Sampler::period());
+        }
     }
 
     //! \brief Finish the initialization of the ovni instrumentation
@@ -244,6 +741,60 @@ public:
     {
         if (_ovniEnabled)
             ovniSetProcessInformation(rank, nranks);
+        if (Communicators::enabled()) {
+            Communicators::initialize();
+
+            // The world communicator exists since the initialization
+            bool ready = _ovniEnabled && (_ovniThreadReady || ovniThreadInitialize());
+            if (ready && _verbosity >= Messages) {
+                communicator(0, MPI_Comm_c2f(MPI_COMM_WORLD));
+                if (rank == 0)
+                    members(0, { nranks, { 0, nranks } });
+            }
+        }
+        if (_statsEnabled)
+            Statistics::initialize(rank, nranks);
+        if (Imbalance::enabled())
+            Imbalance::initialize(rank, nranks);
+        if (Pvars::requested()) {
+            Pvars::initialize();
+
+            // Describe the sampled variables once
+            bool ready = _ovniEnabled && (_ovniThreadReady || ovniThreadInitialize());
+            if (ready) {
+                const std::vector<Pvars::Variable> &variables = Pvars::variables();
+                for (size_t v = 0; v < variables.size(); ++v)
+                    pvar(v, variables[v]);
+            }
+        }
+    }
+
+    //! \brief Finalize the instrumentation that requires MPI
+    //!
+    //! This function must be called before the MPI finalization
+    static void prefinalize()
+    {
+        // Release the performance variables, whose summaries are kept for
+        // the statistics profile
+        Pvars::finalize();
+
+        // Gather and write the communication matrix if enabled
+        if (Matrix::enabled()) {
+            Envar<std::string> file("SONAR_MPI_MATRIX_FILE", "sonar-mpi-matrix.txt");
+            Matrix::finalize(file.get());
+        }
+
+        // Reduce and write the file access statistics if enabled
+        if (FileStatistics::enabled()) {
+            Envar<std::string> file("SONAR_MPI_IO_FILE", "sonar-mpi-io.txt");
+            FileStatistics::finalize(file.get());
+        }
+
+        // Analyze and write the collective imbalance if enabled
+        if (Imbalance::enabled()) {
+            Envar<std::string> file("SONAR_MPI_IMBALANCE_FILE", "sonar-mpi-imbalance.txt");
+            Imbalance::finalize(file.get());
+        }
     }
 
     //! \brief Finalize the ovni instrumentation
@@ -252,43 +803,459 @@ public:
     //! initialized by the function above
     static void finalize()
     {
+        // Check the accuracy of the timestamps
+        Clock::finalize();
+
         // Finalize ovni if enabled
         if (_ovniEnabled)
             ovniFinalize();
+
+        // Write the statistics profile if enabled
+        if (_statsEnabled) {
+            Envar<std::string> directory("SONAR_MPI_STATS_DIR", ".");
+            Statistics::finalize(directory.get());
+        }
+    }
+
+    //! \brief Check whether any instrumentation is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Check whether the callers should be rebound to the MPI functions
+    static bool rebind()
+    {
+        return _rebind;
+    }
+
+    //! \brief Control the instrumentation from an MPI_Pcontrol call
+    //!
+    //! Level 0 stops the ovni and statistics instrumentations, level 1
+    //! starts them, and level 2 also flushes the ovni buffers of the current
+    //! thread. The ovni trace gets a phase event with the level of each call,
+    //! including the levels without a standard meaning
+    //!
+    //! \param level The profiling level
+    static void pcontrol(int level)
+    {
+        if (!_pcontrol)
+            return;
+
+        bool ready = _ovniEnabled && (_ovniThreadReady || ovniThreadInitialize());
+        if (ready) {
+            finishPolling();
+            emit<int32_t>("MXp", level);
+        }
+
+        if (level == 0) {
+            Window::stop();
+        } else if (level == 1) {
+            Window::start();
+        } else if (level == 2) {
+            Window::start();
+            if (ready)
+                ovni_flush();
+        }
+    }
+
+    //! \brief Check whether the current call of an operation is traced
+    //!
+    //! The initialization and finalization operations are always traced. The
+    //! operations excluded by the filter are never traced. The ovni thread of
+    //! the current thread is initialized at its first traced call
+    template <Operation::Code Operation>
+    static bool traced()
+    {
+        if (!_ovniEnabled || !Filter::selected<Operation>())
+            return false;
+        if (__builtin_expect(!_ovniThreadReady, 0) && !ovniThreadInitialize())
+            return false;
+        if (Operation <= sonar::Operation::Finalize || !Sampler::enabled())
+            return true;
+        return Sampler::sample<Operation>();
     }
 
     //! \brief Enter into a interface state at an operation
+    //!
+    //! The call must be traced
     template <Operation::Code Operation>
     static void enter()
     {
-        if (_ovniEnabled)
-            emit(Interfaces[Operation]._enterMCV);
+        finishPolling();
+        emit(Interfaces[Operation]._enterMCV);
+    }
+
+    //! \brief Update the sampling governor with the overhead of a call
+    //!
+    //! \param traced Whether the call was traced
+    //! \param cost The instrumentation time of the call
+    static void govern(bool traced, uint64_t cost)
+    {
+        // Report the new sampling period of the thread
+        if (Sampler::govern(traced, cost, Clock::now()))
+            emit<uint64_t>("MXs", Sampler::period());
     }
 
     //! \brief Exit from a interface state at an operation
+    //!
+    //! The call must be traced
     template <Operation::Code Operation>
     static void exit()
     {
-        if (_ovniEnabled)
-            emit(Interfaces[Operation]._exitMCV);
+        emit(Interfaces[Operation]._exitMCV);
+    }
+
+    //! \brief Emit the information of a point-to-point message
+    //!
+    //! The message event does not fit the communicator, so it is reported in
+    //! a separate event only when it differs from the previous message of the
+    //! thread
+    //!
+    //! \param sent Whether the message was sent or received
+    //! \param peer The destination or source rank in the communicator
+    //! \param tag The tag of the message
+    //! \param bytes The size of the message in bytes
+    //! \param comm The communicator identifier
+    static void message(bool sent, int32_t peer, int32_t tag, uint64_t bytes, int32_t comm)
+    {
+        if (comm != _lastComm) {
+            emit<int32_t>("MPc", comm);
+            _lastComm = comm;
+        }
+        emit<int32_t, int32_t, uint64_t>(sent ? "MPs" : "MPr", peer, tag, bytes);
+    }
+
+    //! \brief Emit the identifier of a persistent request
+    //!
+    //! The identifier is emitted when the request is initialized and each
+    //! time it is started, so the starts of the same request can be
+    //! correlated
+    //!
+    //! \param started Whether the request was started or initialized
+    //! \param id The identifier of the persistent request
+    static void persistent(bool started, uint32_t id)
+    {
+        emit<uint32_t>(started ? "MPa" : "MPi", id);
+    }
+
+    //! \brief Emit the identifier of a created RMA window
+    //!
+    //! \param id The identifier of the window
+    //! \param comm The communicator identifier of the window group
+    static void window(uint32_t id, int32_t comm)
+    {
+        emit<uint32_t, int32_t>("MPn", id, comm);
+    }
+
+    //! \brief Emit an access to the memory of an RMA window
+    //!
+    //! \param written Whether the data was written to or read from the target
+    //! \param target The target rank in the window group
+    //! \param id The identifier of the window
+    //! \param bytes The size of the data in bytes
+    static void access(bool written, int32_t target, uint32_t id, uint64_t bytes)
+    {
+        emit<int32_t, uint32_t, uint64_t>(written ? "MPp" : "MPg", target, id, bytes);
+    }
+
+    //! \brief Emit a synchronization of an RMA window
+    //!
+    //! The synchronizations delimit the access and exposure epochs of the
+    //! window, so the accesses between them belong to the same epoch
+    //!
+    //! \param target The target rank or -1 if there is no single target
+    //! \param id The identifier of the window
+    static void synchronization(int32_t target, uint32_t id)
+    {
+        emit<int32_t, uint32_t>("MPw", target, id);
+    }
+
+    //! \brief Emit the identifier of an opened file
+    //!
+    //! \param id The identifier of the file
+    //! \param comm The communicator identifier of the file group
+    static void file(uint32_t id, int32_t comm)
+    {
+        emit<uint32_t, int32_t>("MPo", id, comm);
+    }
+
+    //! \brief Emit an access to a file
+    //!
+    //! The access event does not fit the file, so it is reported in a
+    //! separate event only when it differs from the previous file access of
+    //! the thread
+    //!
+    //! \param written Whether the data was written to or read from the file
+    //! \param id The identifier of the file
+    //! \param offset The absolute offset in bytes or -1 if it is unknown
+    //! \param bytes The size of the access in bytes
+    static void fileAccess(bool written, uint32_t id, int64_t offset, uint64_t bytes)
+    {
+        if (id != _lastFile) {
+            emit<uint32_t>("MPf", id);
+            _lastFile = id;
+        }
+        emit<int64_t, uint64_t>(written ? "MPW" : "MPR", offset, bytes);
+    }
+
+    //! \brief Emit the job-wide identifier of a created communicator
+    //!
+    //! The MPc events report the communicator identifier of the process, so
+    //! this event maps it to the identifier derived by all members
+    //!
+    //! \param id The job-wide identifier
+    //! \param comm The communicator identifier
+    static void communicator(uint64_t id, int32_t comm)
+    {
+        emit<uint64_t, int32_t>("MPx", id, comm);
+    }
+
+    //! \brief Emit the members of the group of a communicator
+    //!
+    //! The members are reported in a jumbo event with the job-wide
+    //! identifier, the group size, the number of ranges and the ranges of
+    //! world ranks. Large groups are split into several events
+    //!
+    //! \param id The job-wide identifier
+    //! \param members The members of the group
+    static void members(uint64_t id, const Communicators::Members &members)
+    {
+        // Keep the events far below the maximum size of ovni events
+        constexpr size_t MaxRanges = 1 << 16;
+
+        const std::vector<int32_t> &ranges = members._ranges;
+        size_t first = 0;
+        do {
+            size_t count = std::min(ranges.size() / 2 - first, MaxRanges);
+
+            std::vector<int32_t> payload = {
+                (int32_t) (id & 0xFFFFFFFF), (int32_t) (id >> 32),
+                members._size, (int32_t) count
+            };
+            payload.insert(payload.end(), ranges.begin() + first * 2,
+                           ranges.begin() + (first + count) * 2);
+            emitJumbo("MPm", payload);
+
+            first += count;
+        } while (first < ranges.size() / 2);
+    }
+
+    //! \brief Emit the neighbors of a topology communicator
+    //!
+    //! The neighbors are reported once per communicator in a jumbo event with
+    //! the communicator, the number of sources and destinations, and the
+    //! source and destination ranks in the order of the neighborhood
+    //! collectives, so the peers of their blocks can be reconstructed
+    //!
+    //! \param comm The communicator identifier
+    //! \param neighbors The neighbors of the communicator
+    static void topology(int32_t comm, const Topology::Neighbors &neighbors)
+    {
+        std::vector<int32_t> payload;
+        payload.reserve(3 + neighbors._sources.size() + neighbors._destinations.size());
+        payload.push_back(comm);
+        payload.push_back(neighbors._sources.size());
+        payload.push_back(neighbors._destinations.size());
+        payload.insert(payload.end(), neighbors._sources.begin(), neighbors._sources.end());
+        payload.insert(payload.end(), neighbors._destinations.begin(), neighbors._destinations.end());
+
+        emitJumbo("MPT", payload);
+    }
+
+    //! \brief Emit the data exchanged by a neighborhood collective
+    //!
+    //! \param comm The communicator identifier
+    //! \param sent The bytes sent to all destinations
+    //! \param received The bytes received from all sources
+    static void neighborhood(int32_t comm, uint64_t sent, uint64_t received)
+    {
+        if (comm != _lastComm) {
+            emit<int32_t>("MPc", comm);
+            _lastComm = comm;
+        }
+        emit<uint64_t, uint64_t>("MPh", sent, received);
+    }
+
+    //! \brief Emit the description of a sampled performance variable
+    //!
+    //! The variable is reported in a jumbo event with its index in the
+    //! samples, its MPI_T class, whether its values are doubles and its
+    //! null-terminated name
+    //!
+    //! \param index The index of the variable
+    //! \param variable The variable
+    static void pvar(uint32_t index, const Pvars::Variable &variable)
+    {
+        std::vector<uint8_t> payload(3 * sizeof(int32_t) + variable._name.size() + 1);
+        int32_t header[3] = { (int32_t) index, variable._class, variable._double };
+        memcpy(payload.data(), header, sizeof(header));
+        memcpy(payload.data() + sizeof(header), variable._name.c_str(), variable._name.size() + 1);
+
+        emitJumbo("MXn", payload.data(), payload.size());
+    }
+
+    //! \brief Sample the performance variables after an operation
+    //!
+    //! The samples are always summarized for the statistics profile, and
+    //! they are emitted as events if the operation is traced
+    //!
+    //! \param traced Whether the operation is traced
+    static void pvars(bool traced)
+    {
+        Pvars::sample([&](uint32_t index, uint64_t value) {
+            if (traced)
+                emit<uint32_t, uint64_t>("MXv", index, value);
+        });
+    }
+
+    //! \brief Report the lifecycle of a completed request
+    //!
+    //! The request event reports the latency and the blocked time of the
+    //! request. The difference is the time hidden behind computation
+    //!
+    //! \param traced Whether the completion call is traced
+    //! \param lifecycle The lifecycle of the request
+    static void request(bool traced, const Requests::Lifecycle &lifecycle)
+    {
+        if (traced)
+            emit<uint64_t, uint64_t>("MRc", lifecycle._latency, lifecycle._blocked);
+        if (_statsEnabled)
+            Statistics::request(lifecycle._operation, lifecycle._latency, lifecycle._blocked);
     }
 
     //! \brief Guard class to perform automatic scope instrumentation
     //!
     //! Guard objects instrument the enter and exit points of a specific
     //! operation at construction and destruction, respectively
-    template <Operation::Code Operation>
+    template <Operation::Code Operation, Operation::Count Count = Operation::Regular>
     struct Guard {
+        //! Whether the call is inside the instrumentation window
+        bool _active;
+
+        //! Whether the call is traced
+        bool _traced;
+
+        //! Whether the statistics of the call are recorded
+        bool _measured;
+
+        //! Whether the call is a test or probe that is coalesced in polling
+        //! runs
+        static constexpr bool Polls = sonar::Operation::isPolling(Operation);
+
+        //! Whether the enter of the call is deferred until its result or
+        //! duration are known, which happens when coalescing polling runs or
+        //! fusing short calls
+        bool _deferred = false;
+
+        //! Whether the deferred call was already entered
+        bool _entered = false;
+
+        //! Whether the test call completed any request
+        bool _success = true;
+
+        //! The start time of the operation when computing statistics
+        uint64_t _start = 0;
+
+        //! The start time of the call when its enter is deferred
+        uint64_t _deferredStart = 0;
+
+        //! The start time of the guard and the start and end times of the
+        //! wrapped function when the governor measures the overhead of the
+        //! call. A zero start time means the call is not measured
+        uint64_t _overheadStart = 0;
+        uint64_t _callStart = 0;
+        uint64_t _callEnd = 0;
+
         //! \brief Enter the instrumented operation at construction
-        Guard()
+        Guard() :
+            _active(Window::active<Operation>()),
+            _traced(_active && Instrument::traced<Operation>()),
+            _measured(_active && _statsEnabled && Filter::selected<Operation>())
         {
-            Instrument::enter<Operation>();
+            // The sampling decision is taken above for all sampled calls
+            if (__builtin_expect(Sampler::measuring(), 0))
+                _overheadStart = Clock::now();
+
+            if (_traced) {
+                _deferred = (Polls && _coalescePolling) || _fuseThreshold;
+                if (_deferred)
+                    _deferredStart = Clock::now();
+                else
+                    Instrument::enter<Operation>();
+            }
+
+            if (_measured)
+                _start = Clock::now();
         }
 
         //! \brief Exit the instrumented operation at destruction
         ~Guard()
         {
-            Instrument::exit<Operation>();
+            if (_measured)
+                Statistics::record<Operation, Count>(Clock::now() - _start);
+
+            if (_traced) {
+                if (!_deferred || _entered)
+                    Instrument::exit<Operation>();
+                else if (Polls && _coalescePolling && !_success)
+                    Instrument::poll(_deferredStart);
+                else
+                    Instrument::complete<Operation>(_deferredStart);
+            }
+
+            // The overhead includes the deferred and fused events
+            if (__builtin_expect(_overheadStart != 0, 0)) {
+                uint64_t cost = (_callStart - _overheadStart) + (Clock::now() - _callEnd);
+                Instrument::govern(_traced, cost);
+            }
+        }
+
+        //! \brief Mark the start of the wrapped function
+        void calling()
+        {
+            if (__builtin_expect(_overheadStart != 0, 0))
+                _callStart = Clock::now();
+        }
+
+        //! \brief Mark the end of the wrapped function
+        void returned()
+        {
+            if (__builtin_expect(_overheadStart != 0, 0))
+                _callEnd = Clock::now();
+        }
+
+        //! \brief Check whether the test result is needed
+        bool polling() const
+        {
+            return Polls && _traced && _coalescePolling;
+        }
+
+        //! \brief Set whether the test call completed any request or the
+        //! probe call found a message
+        //!
+        //! Successful calls are entered at this point, so the events of the
+        //! completed requests and matched messages are emitted inside the
+        //! call. Otherwise, they may be fused at exit
+        void polled(bool success)
+        {
+            _success = success;
+            if (success && !_fuseThreshold) {
+                Instrument::enterAt<Operation>(_deferredStart);
+                _entered = true;
+            }
+        }
+
+        //! \brief Check whether the call is traced
+        bool traced() const
+        {
+            return _traced;
+        }
+
+        //! \brief Check whether the message events of the call are emitted
+        bool messages() const
+        {
+            return _traced && _verbosity >= Messages;
         }
     };
 };
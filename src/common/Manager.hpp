@@ -7,9 +7,25 @@
 #ifndef MANAGER_HPP
 #define MANAGER_HPP
 
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include "Arguments.hpp"
+#include "Clock.hpp"
+#include "Communicators.hpp"
+#include "FileStatistics.hpp"
+#include "Files.hpp"
+#include "Imbalance.hpp"
 #include "Operation.hpp"
 #include "Instrument.hpp"
+#include "Matrix.hpp"
+#include "Persistent.hpp"
+#include "Pvars.hpp"
+#include "Requests.hpp"
+#include "Rma.hpp"
 #include "Symbol.hpp"
+#include "Topology.hpp"
 
 namespace sonar {
 
@@ -17,17 +33,331 @@ class Manager {
 public:
     template <Operation::Lang Lang, Operation::Code Code, Operation::Count Count,
               typename ReturnTy, typename... Params>
-    static ReturnTy process(const char *name, Params ...params)
+    static ReturnTy process(Symbol::Target<ReturnTy(Params...)> &target, Params ...params)
     {
-        typedef ReturnTy FuncTy(Params...);
+        // Call the function directly when the instrumentation is disabled.
+        // This is a tail call, so the wrapper only adds a flag check. Most
+        // callers skip the wrapper in that case, since they are rebound to
+        // the function at the initialization
+        if (!Instrument::enabled())
+            return (*target.get())(params...);
 
-        static FuncTy *symbol = Symbol::load<FuncTy>(name);
+        return instrument<Lang, Code, Count, ReturnTy>(target.get(), params...);
+    }
 
+private:
+    //! \brief Execute an operation with instrumentation
+    //!
+    //! This function is not inlined to keep the wrappers minimal when the
+    //! instrumentation is disabled
+    template <Operation::Lang Lang, Operation::Code Code, Operation::Count Count,
+              typename ReturnTy, typename... Params>
+    __attribute__((noinline))
+    static ReturnTy instrument(ReturnTy (*symbol)(Params...), Params ...params)
+    {
         // Instrument the operation at guard construction and destruction
-        Instrument::Guard<Code> guard;
+        Instrument::Guard<Code, Count> guard;
+
+        before<Lang, Code>(guard, params...);
+
+        // Execute the operation. The governor excludes its time from the
+        // overhead of the call
+        if constexpr (std::is_void_v<ReturnTy>) {
+            guard.calling();
+            (*symbol)(params...);
+            guard.returned();
+            after<Lang, Code>(guard, params...);
+        } else {
+            guard.calling();
+            ReturnTy ret = (*symbol)(params...);
+            guard.returned();
+            after<Lang, Code>(guard, params...);
+            return ret;
+        }
+    }
+
+    //! \brief Instrument the arguments of an operation before executing it
+    template <Operation::Lang Lang, Operation::Code Code, typename GuardTy, typename... Params>
+    static void before(GuardTy &guard, Params ...params)
+    {
+        if constexpr (Arguments<Code>::Sends) {
+            bool messages = guard.messages();
+            if (messages || Matrix::enabled()) {
+                auto msg = Arguments<Code>::sent(params...);
+                if (messages)
+                    Instrument::message(true, msg._peer, msg._tag, msg._bytes, msg._comm);
+                if (Matrix::enabled())
+                    Matrix::record(msg._comm, msg._peer, msg._bytes);
+            }
+        }
+
+        if constexpr (Arguments<Code>::Neighborhood) {
+            bool messages = guard.messages();
+            if (messages || Matrix::enabled())
+                exchanged<Lang, Code>(messages, params...);
+        }
+
+        if constexpr (Arguments<Code>::Accesses) {
+            if (guard.messages()) {
+                auto access = Arguments<Code>::accessed(params...);
+                uint32_t id = Rma::identifier(Arguments<Code>::template window<Lang>(params...));
+                if constexpr (Arguments<Code>::Writes)
+                    Instrument::access(true, access._target, id, access._written);
+                if constexpr (Arguments<Code>::Reads)
+                    Instrument::access(false, access._target, id, access._read);
+            }
+        }
+
+        // Forget the window before the call, since it resets the handle
+        if constexpr (Arguments<Code>::FreesWindow) {
+            if (Rma::enabled())
+                Rma::forget(Arguments<Code>::template window<Lang>(params...));
+        }
+
+        if constexpr (Arguments<Code>::ClosesFile) {
+            if (Files::enabled())
+                Files::forget(Arguments<Code>::template file<Lang>(params...));
+        }
+
+        // The offset is queried before the access advances the file pointer
+        if constexpr (Arguments<Code>::AccessesFile) {
+            bool messages = guard.messages();
+            if (messages || FileStatistics::enabled()) {
+                uint64_t bytes = Arguments<Code>::bytes(params...);
+                if (messages) {
+                    MPI_File file = Arguments<Code>::template file<Lang>(params...);
+                    int64_t offset = Files::offset(file, Arguments<Code>::AccessPointer,
+                                                   Arguments<Code>::offset(params...));
+                    Instrument::fileAccess(Arguments<Code>::WritesFile, Files::identifier(file),
+                                           offset, bytes);
+                }
+                if (FileStatistics::enabled())
+                    FileStatistics::enter(bytes);
+            }
+        }
+
+        // Record the entry time as close as possible to the call
+        if constexpr (Arguments<Code>::Collective) {
+            if (Imbalance::enabled())
+                Imbalance::enter(Code, Arguments<Code>::comm(params...));
+        }
+
+        // Take the requests before the call, since it may release them and
+        // other threads may reuse their handles
+        if constexpr (Arguments<Code>::Completes) {
+            if (Requests::enabled()) {
+                Requests::begin(Clock::now());
+                Arguments<Code>::template requests<Lang>(Requests::add, params...);
+            }
+        }
+    }
+
+    //! \brief Instrument the arguments of an operation after executing it
+    template <Operation::Lang Lang, Operation::Code Code, typename GuardTy, typename... Params>
+    static void after(GuardTy &guard, Params ...params)
+    {
+        if constexpr (Arguments<Code>::Collective) {
+            if (Imbalance::enabled())
+                Imbalance::exit();
+        }
+
+        if constexpr (Arguments<Code>::AccessesFile) {
+            if (FileStatistics::enabled())
+                FileStatistics::exit<Code>();
+        }
+
+        // Enter the successful polling calls before emitting their events
+        if constexpr (Arguments<Code>::Polls) {
+            if (guard.polling())
+                guard.polled(Arguments<Code>::succeeded(params...));
+        }
+
+        if constexpr (Arguments<Code>::Receives) {
+            if (guard.messages() && Arguments<Code>::matched(params...)) {
+                auto msg = Arguments<Code>::received(params...);
+                Instrument::message(false, msg._peer, msg._tag, msg._bytes, msg._comm);
+            }
+        }
+
+        if constexpr (Arguments<Code>::Synchronizes) {
+            if (guard.messages() && Arguments<Code>::synchronized(params...)) {
+                uint32_t id = Rma::identifier(Arguments<Code>::template window<Lang>(params...));
+                Instrument::synchronization(Arguments<Code>::target(params...), id);
+            }
+        }
+
+        // Files are identified at their opening
+        if constexpr (Arguments<Code>::OpensFile) {
+            if (Files::enabled()) {
+                uint32_t id = Files::create(Arguments<Code>::template file<Lang>(params...));
+                if (guard.messages())
+                    Instrument::file(id, Arguments<Code>::comm(params...));
+            }
+        }
+
+        // Communicators are identified at their creation. All members derive
+        // the same identifier even if they do not trace the call
+        if constexpr (Arguments<Code>::CreatesComm) {
+            MPI_Comm comm = Arguments<Code>::template created<Lang>(params...);
+            if (Communicators::enabled() && comm != MPI_COMM_NULL) {
+                uint64_t id = Communicators::create(Arguments<Code>::parent(params...), comm);
+                if (guard.messages())
+                    reportCommunicator(comm, id);
+            }
+
+            // The neighbors of the topology communicators are reported once
+            if constexpr (Arguments<Code>::CreatesTopology) {
+                if (guard.messages() && comm != MPI_COMM_NULL)
+                    reportTopology(Convert::comm(comm));
+            }
+        }
+
+        // Windows are identified at their creation
+        if constexpr (Arguments<Code>::CreatesWindow) {
+            if (Rma::enabled()) {
+                uint32_t id = Rma::create(Arguments<Code>::template window<Lang>(params...));
+                if (guard.messages())
+                    Instrument::window(id, Arguments<Code>::comm(params...));
+            }
+        }
+
+        if constexpr (Arguments<Code>::Completes) {
+            if (Requests::enabled()) {
+                uint64_t time = Clock::now();
+                Arguments<Code>::template completed<Lang>([&](int index) {
+                    Requests::Lifecycle lifecycle;
+                    if (Requests::complete(index, time, lifecycle))
+                        Instrument::request(guard.traced(), lifecycle);
+                }, params...);
+                Requests::end(time);
+            }
+        }
+
+        if constexpr (Operation::isNonBlocking(Code)) {
+            if (Requests::enabled())
+                Requests::post(request<Lang>(params...), Code, Clock::now());
+        }
+
+        // Persistent requests are identified at their initialization
+        if constexpr (Operation::isPersistent(Code)) {
+            if (Persistent::enabled()) {
+                Persistent::Info info = { Code, 0, Arguments<Code>::PersistentSends, {} };
+                if constexpr (Arguments<Code>::PersistentSends)
+                    info._message = Arguments<Code>::sent(params...);
+
+                uint32_t id = Persistent::create(request<Lang>(params...), info);
+                if (guard.messages())
+                    Instrument::persistent(false, id);
+            }
+        }
+
+        // Each start of a persistent request posts it and sends its message
+        if constexpr (Arguments<Code>::Starts) {
+            if (Persistent::enabled())
+                started<Lang, Code>(guard, params...);
+        }
+
+        // Sample the performance variables inside the state of the operation
+        if (Pvars::enabled() && Pvars::due(Code))
+            Instrument::pvars(guard.traced());
+    }
+
+    //! \brief Get the request returned by a non-blocking or persistent
+    //! operation
+    //!
+    //! The request is the last argument, which precedes the error argument in
+    //! Fortran
+    template <Operation::Lang Lang, typename... Params>
+    static MPI_Request request(Params ...params)
+    {
+        constexpr size_t Position = sizeof...(Params) - ((Lang == Operation::Fortran) ? 2 : 1);
+        return Convert::request<Lang>(std::get<Position>(std::forward_as_tuple(params...)), 0);
+    }
+
+    //! \brief Report the job-wide identifier of a created communicator
+    //!
+    //! The first member of each group also reports the group members
+    static void reportCommunicator(MPI_Comm comm, uint64_t id)
+    {
+        Instrument::communicator(id, Convert::comm(comm));
+
+        Communicators::Members members;
+        if (Communicators::members(comm, members))
+            Instrument::members(id, members);
+    }
+
+    //! \brief Report the neighbors of a topology communicator if they were
+    //! not reported yet
+    static void reportTopology(int32_t comm)
+    {
+        if (Topology::report(comm))
+            Instrument::topology(comm, Topology::neighbors(comm));
+    }
+
+    //! \brief Instrument the data exchanged by a neighborhood collective
+    //!
+    //! The blocks are attributed to the neighbors of the communicator, which
+    //! are cached. The null neighbors of non-periodic cartesian topologies
+    //! exchange no data
+    template <Operation::Lang Lang, Operation::Code Code, typename... Params>
+    static void exchanged(bool messages, Params ...params)
+    {
+        int32_t comm = Arguments<Code>::comm(params...);
+        if (messages)
+            reportTopology(comm);
+
+        // The cached neighbors are only valid until the next query
+        const Topology::Neighbors &neighbors = Topology::neighbors(comm);
+
+        uint64_t sent = 0;
+        for (size_t d = 0; d < neighbors._destinations.size(); ++d) {
+            int32_t peer = neighbors._destinations[d];
+            if (peer == MPI_PROC_NULL)
+                continue;
+
+            uint64_t bytes = Arguments<Code>::template sent<Lang>(d, params...);
+            if (Matrix::enabled())
+                Matrix::record(comm, peer, bytes);
+            sent += bytes;
+        }
+
+        if (messages) {
+            uint64_t received = 0;
+            for (size_t s = 0; s < neighbors._sources.size(); ++s) {
+                if (neighbors._sources[s] != MPI_PROC_NULL)
+                    received += Arguments<Code>::template received<Lang>(s, params...);
+            }
+            Instrument::neighborhood(comm, sent, received);
+        }
+    }
+
+    //! \brief Instrument the persistent requests activated by a start call
+    template <Operation::Lang Lang, Operation::Code Code, typename GuardTy, typename... Params>
+    static void started(GuardTy &guard, Params ...params)
+    {
+        bool messages = guard.messages();
+        uint64_t time = Requests::enabled() ? Clock::now() : 0;
+
+        auto request = [&](int index) {
+            return Arguments<Code>::template request<Lang>(index, params...);
+        };
+
+        Persistent::started(Arguments<Code>::count(params...), request,
+            [&](int index, const Persistent::Info &info) {
+                if (messages)
+                    Instrument::persistent(true, info._id);
+
+                if (info._sends) {
+                    const Message &msg = info._message;
+                    if (messages)
+                        Instrument::message(true, msg._peer, msg._tag, msg._bytes, msg._comm);
+                    if (Matrix::enabled())
+                        Matrix::record(msg._comm, msg._peer, msg._bytes);
+                }
 
-        // Execute the operation
-        return (*symbol)(params...);
+                if (Requests::enabled())
+                    Requests::post(request(index), info._operation, time);
+            });
     }
 };
 
@@ -0,0 +1,108 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <cinttypes>
+#include <cstdio>
+#include <map>
+#include <mpi.h>
+
+#include "IOHandler.hpp"
+#include "Matrix.hpp"
+
+namespace sonar {
+
+bool Matrix::_enabled = false;
+bool Matrix::_finalized = false;
+thread_local Matrix::Row *Matrix::_thread = nullptr;
+std::vector<Matrix::Row *> Matrix::_threads;
+std::mutex Matrix::_lock;
+
+Matrix::Row *Matrix::registerThread()
+{
+    _thread = new Row();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _threads.push_back(_thread);
+
+    return _thread;
+}
+
+void Matrix::finalize(const std::string &path)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // The C and Fortran finalization may be both intercepted
+    if (_finalized)
+        return;
+    _finalized = true;
+
+    // Merge the rows of all threads sorted by peer
+    std::map<int32_t, Counters> row;
+    for (Row *thread : _threads) {
+        for (auto &[peer, counters] : *thread) {
+            Counters &merged = row[peer];
+            merged._messages += counters._messages;
+            merged._bytes += counters._bytes;
+        }
+        delete thread;
+    }
+    _threads.clear();
+    _thread = nullptr;
+
+    // Each entry is sent as the peer, the messages and the bytes
+    std::vector<uint64_t> entries;
+    entries.reserve(row.size() * 3);
+    for (auto &[peer, counters] : row) {
+        entries.push_back(peer);
+        entries.push_back(counters._messages);
+        entries.push_back(counters._bytes);
+    }
+
+    int rank, nranks;
+    PMPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    PMPI_Comm_size(MPI_COMM_WORLD, &nranks);
+
+    int count = entries.size();
+    std::vector<int> counts((rank == 0) ? nranks : 0);
+    if (PMPI_Gather(&count, 1, MPI_INT, counts.data(), 1, MPI_INT, 0,
+                    MPI_COMM_WORLD) != MPI_SUCCESS)
+        IOHandler::fail("Could not gather the communication matrix");
+
+    std::vector<int> displs(counts.size());
+    std::vector<uint64_t> matrix;
+    if (rank == 0) {
+        for (int r = 1; r < nranks; ++r)
+            displs[r] = displs[r - 1] + counts[r - 1];
+        matrix.resize(displs.back() + counts.back());
+    }
+
+    if (PMPI_Gatherv(entries.data(), count, MPI_UINT64_T, matrix.data(),
+                     counts.data(), displs.data(), MPI_UINT64_T, 0,
+                     MPI_COMM_WORLD) != MPI_SUCCESS)
+        IOHandler::fail("Could not gather the communication matrix");
+
+    if (rank != 0)
+        return;
+
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr)
+        IOHandler::fail("Could not open the communication matrix file ", path);
+
+    fprintf(file, "# Sonar MPI point-to-point communication matrix of %d ranks\n", nranks);
+    fprintf(file, "# source destination messages bytes\n");
+
+    for (int source = 0; source < nranks; ++source) {
+        for (int e = displs[source]; e < displs[source] + counts[source]; e += 3) {
+            fprintf(file, "%d %" PRIu64 " %" PRIu64 " %" PRIu64 "\n", source,
+                    matrix[e], matrix[e + 1], matrix[e + 2]);
+        }
+    }
+
+    if (fclose(file))
+        IOHandler::fail("Could not write the communication matrix file ", path);
+}
+
+} // namespace sonar
@@ -0,0 +1,96 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef MATRIX_HPP
+#define MATRIX_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Communicator.hpp"
+
+namespace sonar {
+
+//! Class that accumulates the point-to-point communication matrix. Each rank
+//! counts the messages and bytes sent to each world rank, and the rows of all
+//! ranks are gathered and written in a single file at finalization
+class Matrix {
+private:
+    //! The counters of the messages sent to a peer
+    struct Counters {
+        uint64_t _messages;
+        uint64_t _bytes;
+    };
+
+    //! The sparse row of a thread, indexed by the world rank of the peers.
+    //! The rows are only read at finalization, when no other thread can call
+    //! any MPI operation
+    using Row = std::unordered_map<int32_t, Counters>;
+
+    //! Whether the matrix is enabled
+    static bool _enabled;
+
+    //! Whether the matrix was already written
+    static bool _finalized;
+
+    //! The row of the current thread
+    static thread_local Row *_thread;
+
+    //! The rows of all threads and the lock protecting them
+    static std::vector<Row *> _threads;
+    static std::mutex _lock;
+
+    //! \brief Allocate and register the row of the current thread
+    static Row *registerThread();
+
+public:
+    //! \brief Enable the communication matrix
+    static void enable()
+    {
+        _enabled = true;
+    }
+
+    //! \brief Check whether the communication matrix is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Record a sent message
+    //!
+    //! \param comm The communicator identifier
+    //! \param peer The destination rank in the communicator
+    //! \param bytes The size of the message in bytes
+    static void record(int32_t comm, int32_t peer, uint64_t bytes)
+    {
+        int32_t world = Communicator::worldRank(comm, peer);
+        if (world < 0)
+            return;
+
+        Row *row = _thread;
+        if (__builtin_expect(row == nullptr, 0))
+            row = registerThread();
+
+        Counters &counters = (*row)[world];
+        counters._messages += 1;
+        counters._bytes += bytes;
+    }
+
+    //! \brief Gather the rows of all ranks and write the matrix
+    //!
+    //! This is a collective operation that must be called by all ranks
+    //! before the MPI finalization. Rank zero writes the file
+    //!
+    //! \param path The path of the matrix file
+    static void finalize(const std::string &path);
+};
+
+} // namespace sonar
+
+#endif // MATRIX_HPP
@@ -7,6 +7,8 @@
 #ifndef OPERATION_HPP
 #define OPERATION_HPP
 
+#include <strings.h>
+
 namespace sonar {
 
 class Operation {
@@ -18,9 +20,11 @@ public:
         Wait, Waitall, Waitany, Waitsome,
         //! Testing requests
         Test, Testall, Testany, Testsome,
+        //! Probing messages
+        Probe, Iprobe, Mprobe, Improbe,
         //! Blocking primitives
         Recv, Send, Bsend, Rsend, Ssend,
-        Sendrecv, SendrecvReplace,
+        Sendrecv, SendrecvReplace, Mrecv,
         //! Blocking collectives
         Allgather, Allgatherv, Allreduce,
         Alltoall, Alltoallv, Alltoallw,
@@ -29,13 +33,67 @@ public:
         Scatter, Scatterv, Scan, Exscan,
         //! Non-blocking primitives
         Irecv, Isend, Ibsend, Irsend, Issend,
-        Isendrecv, IsendrecvReplace,
+        Isendrecv, IsendrecvReplace, Imrecv,
         //! Non-blocking collectives
         Iallgather, Iallgatherv, Iallreduce,
         Ialltoall, Ialltoallv, Ialltoallw,
         Ibarrier, Ibcast, Igather, Igatherv,
         Ireduce, IreduceScatter, IreduceScatterBlock,
         Iscatter, Iscatterv, Iscan, Iexscan,
+        //! Persistent primitives
+        BsendInit, RecvInit, RsendInit, SendInit, SsendInit,
+        //! Partitioned primitives
+        PrecvInit, PsendInit, Pready, PreadyRange, PreadyList, Parrived,
+        //! Persistent collectives
+        AllgatherInit, AllgathervInit, AllreduceInit,
+        AlltoallInit, AlltoallvInit, AlltoallwInit,
+        BarrierInit, BcastInit, GatherInit, GathervInit,
+        ReduceInit, ReduceScatterInit, ReduceScatterBlockInit,
+        ScatterInit, ScattervInit, ScanInit, ExscanInit,
+        //! Starting persistent requests
+        Start, Startall,
+        //! Creating and freeing RMA windows
+        WinAllocate, WinAllocateShared, WinCreate, WinCreateDynamic, WinFree,
+        //! RMA communication
+        Accumulate, CompareAndSwap, FetchAndOp, Get, GetAccumulate, Put,
+        //! Request-based RMA communication
+        Raccumulate, Rget, RgetAccumulate, Rput,
+        //! RMA active target synchronization
+        WinFence, WinPost, WinStart, WinComplete, WinWait, WinTest,
+        //! RMA passive target synchronization
+        WinLock, WinUnlock, WinLockAll, WinUnlockAll,
+        WinFlush, WinFlushAll, WinFlushLocal, WinFlushLocalAll, WinSync,
+        //! Opening and managing files
+        FileOpen, FileClose, FileSetView, FileSync,
+        //! Independent file accesses
+        FileRead, FileReadAt, FileReadShared,
+        FileWrite, FileWriteAt, FileWriteShared,
+        //! Collective file accesses
+        FileReadAll, FileReadAtAll, FileReadOrdered,
+        FileWriteAll, FileWriteAtAll, FileWriteOrdered,
+        //! Non-blocking file accesses
+        FileIread, FileIreadAt, FileIreadShared,
+        FileIwrite, FileIwriteAt, FileIwriteShared,
+        FileIreadAll, FileIreadAtAll, FileIwriteAll, FileIwriteAtAll,
+        //! Split collective file accesses
+        FileReadAllBegin, FileReadAllEnd, FileReadAtAllBegin, FileReadAtAllEnd,
+        FileReadOrderedBegin, FileReadOrderedEnd,
+        FileWriteAllBegin, FileWriteAllEnd, FileWriteAtAllBegin, FileWriteAtAllEnd,
+        FileWriteOrderedBegin, FileWriteOrderedEnd,
+        //! Neighborhood collectives
+        NeighborAllgather, NeighborAllgatherv,
+        NeighborAlltoall, NeighborAlltoallv, NeighborAlltoallw,
+        //! Non-blocking neighborhood collectives
+        IneighborAllgather, IneighborAllgatherv,
+        IneighborAlltoall, IneighborAlltoallv, IneighborAlltoallw,
+        //! Persistent neighborhood collectives
+        NeighborAllgatherInit, NeighborAllgathervInit,
+        NeighborAlltoallInit, NeighborAlltoallvInit, NeighborAlltoallwInit,
+        //! Creating topology communicators
+        CartCreate, GraphCreate, DistGraphCreate, DistGraphCreateAdjacent,
+        //! Creating and freeing communicators
+        CommDup, CommSplit, CommSplitType, CommCreate, CommCreateGroup,
+        IntercommCreate, CommFree,
         //! Invalid value
         NumCodes,
     };
@@ -50,6 +108,284 @@ public:
         NumVersions,
     };
 
+    //! The MPI name of each operation
+    static constexpr const char *Names[NumCodes] = {
+        //! Initializing
+        [Init]                = "MPI_Init",
+        [InitThread]          = "MPI_Init_thread",
+        [Finalize]            = "MPI_Finalize",
+        //! Waiting requests
+        [Wait]                = "MPI_Wait",
+        [Waitall]             = "MPI_Waitall",
+        [Waitany]             = "MPI_Waitany",
+        [Waitsome]            = "MPI_Waitsome",
+        //! Testing requests
+        [Test]                = "MPI_Test",
+        [Testall]             = "MPI_Testall",
+        [Testany]             = "MPI_Testany",
+        [Testsome]            = "MPI_Testsome",
+        //! Probing messages
+        [Probe]               = "MPI_Probe",
+        [Iprobe]              = "MPI_Iprobe",
+        [Mprobe]              = "MPI_Mprobe",
+        [Improbe]             = "MPI_Improbe",
+        //! Blocking primitives
+        [Recv]                = "MPI_Recv",
+        [Send]                = "MPI_Send",
+        [Bsend]               = "MPI_Bsend",
+        [Rsend]               = "MPI_Rsend",
+        [Ssend]               = "MPI_Ssend",
+        [Sendrecv]            = "MPI_Sendrecv",
+        [SendrecvReplace]     = "MPI_Sendrecv_replace",
+        [Mrecv]               = "MPI_Mrecv",
+        //! Blocking collectives
+        [Allgather]           = "MPI_Allgather",
+        [Allgatherv]          = "MPI_Allgatherv",
+        [Allreduce]           = "MPI_Allreduce",
+        [Alltoall]            = "MPI_Alltoall",
+        [Alltoallv]           = "MPI_Alltoallv",
+        [Alltoallw]           = "MPI_Alltoallw",
+        [Barrier]             = "MPI_Barrier",
+        [Bcast]               = "MPI_Bcast",
+        [Gather]              = "MPI_Gather",
+        [Gatherv]             = "MPI_Gatherv",
+        [Reduce]              = "MPI_Reduce",
+        [ReduceScatter]       = "MPI_Reduce_scatter",
+        [ReduceScatterBlock]  = "MPI_Reduce_scatter_block",
+        [Scatter]             = "MPI_Scatter",
+        [Scatterv]            = "MPI_Scatterv",
+        [Scan]                = "MPI_Scan",
+        [Exscan]              = "MPI_Exscan",
+        //! Non-blocking primitives
+        [Irecv]               = "MPI_Irecv",
+        [Isend]               = "MPI_Isend",
+        [Ibsend]              = "MPI_Ibsend",
+        [Irsend]              = "MPI_Irsend",
+        [Issend]              = "MPI_Issend",
+        [Isendrecv]           = "MPI_Isendrecv",
+        [IsendrecvReplace]    = "MPI_Isendrecv_replace",
+        [Imrecv]              = "MPI_Imrecv",
+        //! Non-blocking collectives
+        [Iallgather]          = "MPI_Iallgather",
+        [Iallgatherv]         = "MPI_Iallgatherv",
+        [Iallreduce]          = "MPI_Iallreduce",
+        [Ialltoall]           = "MPI_Ialltoall",
+        [Ialltoallv]          = "MPI_Ialltoallv",
+        [Ialltoallw]          = "MPI_Ialltoallw",
+        [Ibarrier]            = "MPI_Ibarrier",
+        [Ibcast]              = "MPI_Ibcast",
+        [Igather]             = "MPI_Igather",
+        [Igatherv]            = "MPI_Igatherv",
+        [Ireduce]             = "MPI_Ireduce",
+        [IreduceScatter]      = "MPI_Ireduce_scatter",
+        [IreduceScatterBlock] = "MPI_Ireduce_scatter_block",
+        [Iscatter]            = "MPI_Iscatter",
+        [Iscatterv]           = "MPI_Iscatterv",
+        [Iscan]               = "MPI_Iscan",
+        [Iexscan]             = "MPI_Iexscan",
+        //! Persistent primitives
+        [BsendInit]           = "MPI_Bsend_init",
+        [RecvInit]            = "MPI_Recv_init",
+        [RsendInit]           = "MPI_Rsend_init",
+        [SendInit]            = "MPI_Send_init",
+        [SsendInit]           = "MPI_Ssend_init",
+        //! Partitioned primitives
+        [PrecvInit]           = "MPI_Precv_init",
+        [PsendInit]           = "MPI_Psend_init",
+        [Pready]              = "MPI_Pready",
+        [PreadyRange]         = "MPI_Pready_range",
+        [PreadyList]          = "MPI_Pready_list",
+        [Parrived]            = "MPI_Parrived",
+        //! Persistent collectives
+        [AllgatherInit]       = "MPI_Allgather_init",
+        [AllgathervInit]      = "MPI_Allgatherv_init",
+        [AllreduceInit]       = "MPI_Allreduce_init",
+        [AlltoallInit]        = "MPI_Alltoall_init",
+        [AlltoallvInit]       = "MPI_Alltoallv_init",
+        [AlltoallwInit]       = "MPI_Alltoallw_init",
+        [BarrierInit]         = "MPI_Barrier_init",
+        [BcastInit]           = "MPI_Bcast_init",
+        [GatherInit]          = "MPI_Gather_init",
+        [GathervInit]         = "MPI_Gatherv_init",
+        [ReduceInit]          = "MPI_Reduce_init",
+        [ReduceScatterInit]   = "MPI_Reduce_scatter_init",
+        [ReduceScatterBlockInit] = "MPI_Reduce_scatter_block_init",
+        [ScatterInit]         = "MPI_Scatter_init",
+        [ScattervInit]        = "MPI_Scatterv_init",
+        [ScanInit]            = "MPI_Scan_init",
+        [ExscanInit]          = "MPI_Exscan_init",
+        //! Starting persistent requests
+        [Start]               = "MPI_Start",
+        [Startall]            = "MPI_Startall",
+        //! Creating and freeing RMA windows
+        [WinAllocate]         = "MPI_Win_allocate",
+        [WinAllocateShared]   = "MPI_Win_allocate_shared",
+        [WinCreate]           = "MPI_Win_create",
+        [WinCreateDynamic]    = "MPI_Win_create_dynamic",
+        [WinFree]             = "MPI_Win_free",
+        //! RMA communication
+        [Accumulate]          = "MPI_Accumulate",
+        [CompareAndSwap]      = "MPI_Compare_and_swap",
+        [FetchAndOp]          = "MPI_Fetch_and_op",
+        [Get]                 = "MPI_Get",
+        [GetAccumulate]       = "MPI_Get_accumulate",
+        [Put]                 = "MPI_Put",
+        //! Request-based RMA communication
+        [Raccumulate]         = "MPI_Raccumulate",
+        [Rget]                = "MPI_Rget",
+        [RgetAccumulate]      = "MPI_Rget_accumulate",
+        [Rput]                = "MPI_Rput",
+        //! RMA active target synchronization
+        [WinFence]            = "MPI_Win_fence",
+        [WinPost]             = "MPI_Win_post",
+        [WinStart]            = "MPI_Win_start",
+        [WinComplete]         = "MPI_Win_complete",
+        [WinWait]             = "MPI_Win_wait",
+        [WinTest]             = "MPI_Win_test",
+        //! RMA passive target synchronization
+        [WinLock]             = "MPI_Win_lock",
+        [WinUnlock]           = "MPI_Win_unlock",
+        [WinLockAll]          = "MPI_Win_lock_all",
+        [WinUnlockAll]        = "MPI_Win_unlock_all",
+        [WinFlush]            = "MPI_Win_flush",
+        [WinFlushAll]         = "MPI_Win_flush_all",
+        [WinFlushLocal]       = "MPI_Win_flush_local",
+        [WinFlushLocalAll]    = "MPI_Win_flush_local_all",
+        [WinSync]             = "MPI_Win_sync",
+        //! Opening and managing files
+        [FileOpen]            = "MPI_File_open",
+        [FileClose]           = "MPI_File_close",
+        [FileSetView]         = "MPI_File_set_view",
+        [FileSync]            = "MPI_File_sync",
+        //! Independent file accesses
+        [FileRead]            = "MPI_File_read",
+        [FileReadAt]          = "MPI_File_read_at",
+        [FileReadShared]      = "MPI_File_read_shared",
+        [FileWrite]           = "MPI_File_write",
+        [FileWriteAt]         = "MPI_File_write_at",
+        [FileWriteShared]     = "MPI_File_write_shared",
+        //! Collective file accesses
+        [FileReadAll]         = "MPI_File_read_all",
+        [FileReadAtAll]       = "MPI_File_read_at_all",
+        [FileReadOrdered]     = "MPI_File_read_ordered",
+        [FileWriteAll]        = "MPI_File_write_all",
+        [FileWriteAtAll]      = "MPI_File_write_at_all",
+        [FileWriteOrdered]    = "MPI_File_write_ordered",
+        //! Non-blocking file accesses
+        [FileIread]           = "MPI_File_iread",
+        [FileIreadAt]         = "MPI_File_iread_at",
+        [FileIreadShared]     = "MPI_File_iread_shared",
+        [FileIwrite]          = "MPI_File_iwrite",
+        [FileIwriteAt]        = "MPI_File_iwrite_at",
+        [FileIwriteShared]    = "MPI_File_iwrite_shared",
+        [FileIreadAll]        = "MPI_File_iread_all",
+        [FileIreadAtAll]      = "MPI_File_iread_at_all",
+        [FileIwriteAll]       = "MPI_File_iwrite_all",
+        [FileIwriteAtAll]     = "MPI_File_iwrite_at_all",
+        //! Split collective file accesses
+        [FileReadAllBegin]    = "MPI_File_read_all_begin",
+        [FileReadAllEnd]      = "MPI_File_read_all_end",
+        [FileReadAtAllBegin]  = "MPI_File_read_at_all_begin",
+        [FileReadAtAllEnd]    = "MPI_File_read_at_all_end",
+        [FileReadOrderedBegin] = "MPI_File_read_ordered_begin",
+        [FileReadOrderedEnd]  = "MPI_File_read_ordered_end",
+        [FileWriteAllBegin]   = "MPI_File_write_all_begin",
+        [FileWriteAllEnd]     = "MPI_File_write_all_end",
+        [FileWriteAtAllBegin] = "MPI_File_write_at_all_begin",
+        [FileWriteAtAllEnd]   = "MPI_File_write_at_all_end",
+        [FileWriteOrderedBegin] = "MPI_File_write_ordered_begin",
+        [FileWriteOrderedEnd] = "MPI_File_write_ordered_end",
+        //! Neighborhood collectives
+        [NeighborAllgather]   = "MPI_Neighbor_allgather",
+        [NeighborAllgatherv]  = "MPI_Neighbor_allgatherv",
+        [NeighborAlltoall]    = "MPI_Neighbor_alltoall",
+        [NeighborAlltoallv]   = "MPI_Neighbor_alltoallv",
+        [NeighborAlltoallw]   = "MPI_Neighbor_alltoallw",
+        //! Non-blocking neighborhood collectives
+        [IneighborAllgather]  = "MPI_Ineighbor_allgather",
+        [IneighborAllgatherv] = "MPI_Ineighbor_allgatherv",
+        [IneighborAlltoall]   = "MPI_Ineighbor_alltoall",
+        [IneighborAlltoallv]  = "MPI_Ineighbor_alltoallv",
+        [IneighborAlltoallw]  = "MPI_Ineighbor_alltoallw",
+        //! Persistent neighborhood collectives
+        [NeighborAllgatherInit] = "MPI_Neighbor_allgather_init",
+        [NeighborAllgathervInit] = "MPI_Neighbor_allgatherv_init",
+        [NeighborAlltoallInit] = "MPI_Neighbor_alltoall_init",
+        [NeighborAlltoallvInit] = "MPI_Neighbor_alltoallv_init",
+        [NeighborAlltoallwInit] = "MPI_Neighbor_alltoallw_init",
+        //! Creating topology communicators
+        [CartCreate]          = "MPI_Cart_create",
+        [GraphCreate]         = "MPI_Graph_create",
+        [DistGraphCreate]     = "MPI_Dist_graph_create",
+        [DistGraphCreateAdjacent] = "MPI_Dist_graph_create_adjacent",
+        //! Creating and freeing communicators
+        [CommDup]             = "MPI_Comm_dup",
+        [CommSplit]           = "MPI_Comm_split",
+        [CommSplitType]       = "MPI_Comm_split_type",
+        [CommCreate]          = "MPI_Comm_create",
+        [CommCreateGroup]     = "MPI_Comm_create_group",
+        [IntercommCreate]     = "MPI_Intercomm_create",
+        [CommFree]            = "MPI_Comm_free",
+    };
+
+    //! The name of each count version
+    static constexpr const char *VersionNames[NumVersions] = {
+        [Regular] = "regular",
+        [Large]   = "large",
+    };
+
+    //! \brief Check whether an operation tests the completion of requests
+    static constexpr bool isTest(Code code)
+    {
+        return code >= Test && code <= Testsome;
+    }
+
+    //! \brief Check whether an operation polls for the completion of requests
+    //! or the arrival of messages or partitions, or for the end of an RMA
+    //! exposure epoch
+    static constexpr bool isPolling(Code code)
+    {
+        return isTest(code) || code == Iprobe || code == Improbe
+            || code == Parrived || code == WinTest;
+    }
+
+    //! \brief Check whether an operation waits or tests the completion of
+    //! requests
+    static constexpr bool isCompletion(Code code)
+    {
+        return code >= Wait && code <= Testsome;
+    }
+
+    //! \brief Check whether an operation starts a request
+    static constexpr bool isNonBlocking(Code code)
+    {
+        return (code >= Irecv && code <= Iexscan)
+            || (code >= Raccumulate && code <= Rput)
+            || (code >= FileIread && code <= FileIwriteAtAll)
+            || (code >= IneighborAllgather && code <= IneighborAlltoallw);
+    }
+
+    //! \brief Check whether an operation initializes a persistent or
+    //! partitioned request
+    static constexpr bool isPersistent(Code code)
+    {
+        return (code >= BsendInit && code <= PsendInit)
+            || (code >= AllgatherInit && code <= ExscanInit)
+            || (code >= NeighborAllgatherInit && code <= NeighborAlltoallwInit);
+    }
+
+    //! \brief Find an operation by its name, with or without the MPI prefix
+    //!
+    //! \returns The operation code or NumCodes if the name is not valid
+    static Code find(const char *name)
+    {
+        for (int code = 0; code < NumCodes; ++code) {
+            if (strcasecmp(name, Names[code]) == 0 || strcasecmp(name, Names[code] + 4) == 0)
+                return (Code) code;
+        }
+        return NumCodes;
+    }
+
     //! The programming language of the operation
     enum Lang {
         C = 0,
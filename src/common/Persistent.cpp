@@ -0,0 +1,35 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include "Persistent.hpp"
+
+namespace sonar {
+
+bool Persistent::_enabled = false;
+uint32_t Persistent::_identifiers = 0;
+std::unordered_map<MPI_Request, Persistent::Info> Persistent::_requests;
+std::mutex Persistent::_lock;
+
+uint32_t Persistent::create(MPI_Request request, Info info)
+{
+    if (request == MPI_REQUEST_NULL)
+        return 0;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    info._id = ++_identifiers;
+
+    // Replace any stale entry of a request that was not freed explicitly
+    _requests[request] = info;
+    return info._id;
+}
+
+void Persistent::forget(MPI_Request request)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _requests.erase(request);
+}
+
+} // namespace sonar
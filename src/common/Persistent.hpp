@@ -0,0 +1,96 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef PERSISTENT_HPP
+#define PERSISTENT_HPP
+
+#include <cstdint>
+#include <mpi.h>
+#include <mutex>
+#include <unordered_map>
+
+#include "Arguments.hpp"
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that tracks the persistent requests from their initialization until
+//! they are freed. Each persistent request gets a process-wide identifier at
+//! its initialization, so the starts of the same request can be correlated.
+//! The requests of persistent sends also keep their message, which is sent at
+//! each start
+class Persistent {
+public:
+    //! A persistent request
+    struct Info {
+        //! The operation that initialized the request
+        Operation::Code _operation;
+        //! The identifier of the request
+        uint32_t _id;
+        //! Whether the request sends a message
+        bool _sends;
+        //! The message sent at each start
+        Message _message;
+    };
+
+private:
+    //! Whether the tracking is enabled
+    static bool _enabled;
+
+    //! The number of assigned identifiers
+    static uint32_t _identifiers;
+
+    //! The persistent requests and the lock protecting them
+    static std::unordered_map<MPI_Request, Info> _requests;
+    static std::mutex _lock;
+
+public:
+    //! \brief Enable the tracking
+    static void enable()
+    {
+        _enabled = true;
+    }
+
+    //! \brief Check whether the tracking is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Record an initialized persistent request
+    //!
+    //! \param request The request handle
+    //! \param info The request information without identifier
+    //!
+    //! \returns The identifier of the request
+    static uint32_t create(MPI_Request request, Info info);
+
+    //! \brief Remove a freed request
+    static void forget(MPI_Request request);
+
+    //! \brief Find the persistent requests activated by a start call
+    //!
+    //! The lookup takes the lock once per call
+    //!
+    //! \param count The number of requests
+    //! \param request The function that returns the handle of a request
+    //! \param func The function called with the index and information of each
+    //! persistent request
+    template <typename RequestFuncTy, typename FuncTy>
+    static void started(int count, RequestFuncTy request, FuncTy func)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        for (int r = 0; r < count; ++r) {
+            auto it = _requests.find(request(r));
+            if (it != _requests.end())
+                func(r, it->second);
+        }
+    }
+};
+
+} // namespace sonar
+
+#endif // PERSISTENT_HPP
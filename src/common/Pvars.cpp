@@ -0,0 +1,240 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <sstream>
+
+#include "IOHandler.hpp"
+#include "Pvars.hpp"
+
+namespace sonar {
+
+bool Pvars::_enabled = false;
+std::vector<std::string> Pvars::_names;
+std::bitset<Operation::NumCodes> Pvars::_operations;
+uint64_t Pvars::_period = 0;
+std::atomic<uint64_t> Pvars::_next(0);
+MPI_T_pvar_session Pvars::_session = MPI_T_PVAR_SESSION_NULL;
+std::vector<Pvars::Variable> Pvars::_variables;
+MPI_Comm Pvars::_world = MPI_COMM_NULL;
+std::mutex Pvars::_lock;
+
+//! \brief Get the size of the elements of a supported variable type
+//!
+//! \returns The size in bytes or zero if the type is not supported
+static size_t elementSize(MPI_Datatype type)
+{
+    if (type == MPI_INT)
+        return sizeof(int);
+    if (type == MPI_UNSIGNED)
+        return sizeof(unsigned);
+    if (type == MPI_UNSIGNED_LONG)
+        return sizeof(unsigned long);
+    if (type == MPI_UNSIGNED_LONG_LONG)
+        return sizeof(unsigned long long);
+    if (type == MPI_COUNT)
+        return sizeof(MPI_Count);
+    if (type == MPI_DOUBLE)
+        return sizeof(double);
+    return 0;
+}
+
+//! \brief Get an element of a variable value as an integer or a double
+template <typename T>
+static T element(const std::vector<uint8_t> &buffer, MPI_Datatype type, int index)
+{
+    const uint8_t *data = buffer.data() + index * elementSize(type);
+    if (type == MPI_INT)
+        return *(const int *) data;
+    if (type == MPI_UNSIGNED)
+        return *(const unsigned *) data;
+    if (type == MPI_UNSIGNED_LONG)
+        return *(const unsigned long *) data;
+    if (type == MPI_UNSIGNED_LONG_LONG)
+        return *(const unsigned long long *) data;
+    if (type == MPI_COUNT)
+        return *(const MPI_Count *) data;
+    return *(const double *) data;
+}
+
+//! \brief Compare two raw values of a variable
+static bool less(bool isDouble, uint64_t a, uint64_t b)
+{
+    if (!isDouble)
+        return a < b;
+
+    double x, y;
+    memcpy(&x, &a, sizeof(x));
+    memcpy(&y, &b, sizeof(y));
+    return x < y;
+}
+
+void Pvars::configure(const std::string &names,
+                      const std::bitset<Operation::NumCodes> &operations,
+                      uint64_t period)
+{
+    std::istringstream stream(names);
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        token.erase(std::remove_if(token.begin(), token.end(), ::isspace), token.end());
+        if (!token.empty())
+            _names.push_back(token);
+    }
+
+    _operations = operations;
+    _period = period;
+}
+
+void Pvars::initialize()
+{
+    if (_names.empty())
+        return;
+
+    // The accesses to the tools interface are serialized by the lock
+    int provided;
+    if (PMPI_T_init_thread(MPI_THREAD_SERIALIZED, &provided) != MPI_SUCCESS) {
+        IOHandler::warn("Could not initialize the MPI tools interface");
+        return;
+    }
+
+    if (PMPI_T_pvar_session_create(&_session) != MPI_SUCCESS) {
+        IOHandler::warn("Could not create a performance variable session");
+        PMPI_T_finalize();
+        return;
+    }
+
+    int num;
+    PMPI_T_pvar_get_num(&num);
+
+    _world = MPI_COMM_WORLD;
+    for (const std::string &name : _names) {
+        bool found = false;
+        for (int index = 0; index < num && !found; ++index) {
+            char buffer[256];
+            int length = sizeof(buffer);
+            int verbosity, varClass, bind, readonly, continuous, atomic;
+            MPI_Datatype type;
+            MPI_T_enum enumtype;
+            if (PMPI_T_pvar_get_info(index, buffer, &length, &verbosity, &varClass, &type,
+                                     &enumtype, nullptr, nullptr, &bind, &readonly,
+                                     &continuous, &atomic) != MPI_SUCCESS)
+                continue;
+            if (name != buffer)
+                continue;
+            found = true;
+
+            if (elementSize(type) == 0) {
+                IOHandler::warn("Ignoring performance variable ", name, " with unsupported type");
+                break;
+            }
+
+            void *object = nullptr;
+            if (bind == MPI_T_BIND_MPI_COMM) {
+                object = &_world;
+            } else if (bind != MPI_T_BIND_NO_OBJECT) {
+                IOHandler::warn("Ignoring performance variable ", name, " with unsupported binding");
+                break;
+            }
+
+            Variable variable = {};
+            variable._name = name;
+            variable._index = index;
+            variable._class = varClass;
+            variable._type = type;
+            variable._double = (type == MPI_DOUBLE);
+            if (PMPI_T_pvar_handle_alloc(_session, index, object, &variable._handle,
+                                         &variable._count) != MPI_SUCCESS) {
+                IOHandler::warn("Could not bind the performance variable ", name);
+                break;
+            }
+
+            // The variables that are not continuous must be started
+            if (!continuous && PMPI_T_pvar_start(_session, variable._handle) != MPI_SUCCESS) {
+                IOHandler::warn("Could not start the performance variable ", name);
+                PMPI_T_pvar_handle_free(_session, &variable._handle);
+                break;
+            }
+            _variables.push_back(variable);
+        }
+
+        if (!found)
+            IOHandler::warn("Ignoring unknown performance variable ", name);
+    }
+
+    _enabled = !_variables.empty();
+    if (!_enabled) {
+        PMPI_T_pvar_session_free(&_session);
+        PMPI_T_finalize();
+    }
+}
+
+uint64_t Pvars::read(Variable &variable)
+{
+    std::vector<uint8_t> buffer(variable._count * elementSize(variable._type));
+    if (PMPI_T_pvar_read(_session, variable._handle, buffer.data()) != MPI_SUCCESS)
+        return variable._last;
+
+    // The elements of a variable are summed
+    uint64_t value;
+    if (variable._double) {
+        double sum = 0;
+        for (int e = 0; e < variable._count; ++e)
+            sum += element<double>(buffer, variable._type, e);
+        memcpy(&value, &sum, sizeof(value));
+    } else {
+        value = 0;
+        for (int e = 0; e < variable._count; ++e)
+            value += element<uint64_t>(buffer, variable._type, e);
+    }
+
+    if (variable._samples == 0 || less(variable._double, value, variable._min))
+        variable._min = value;
+    if (variable._samples == 0 || less(variable._double, variable._max, value))
+        variable._max = value;
+    variable._last = value;
+    ++variable._samples;
+    return value;
+}
+
+void Pvars::report(FILE *file)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    fprintf(file, "# pvar name samples min max last\n");
+    for (const Variable &variable : _variables) {
+        if (variable._double) {
+            double values[3];
+            memcpy(&values[0], &variable._min, sizeof(double));
+            memcpy(&values[1], &variable._max, sizeof(double));
+            memcpy(&values[2], &variable._last, sizeof(double));
+            fprintf(file, "pvar %s %" PRIu64 " %g %g %g\n", variable._name.c_str(),
+                    variable._samples, values[0], values[1], values[2]);
+        } else {
+            fprintf(file, "pvar %s %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 "\n",
+                    variable._name.c_str(), variable._samples, variable._min,
+                    variable._max, variable._last);
+        }
+    }
+}
+
+void Pvars::finalize()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_enabled)
+        return;
+
+    for (Variable &variable : _variables)
+        PMPI_T_pvar_handle_free(_session, &variable._handle);
+    PMPI_T_pvar_session_free(&_session);
+    PMPI_T_finalize();
+
+    // Keep the summaries of the variables for the profile
+    _enabled = false;
+}
+
+} // namespace sonar
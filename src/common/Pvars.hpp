@@ -0,0 +1,152 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef PVARS_HPP
+#define PVARS_HPP
+
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <cstdio>
+#include <mpi.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Clock.hpp"
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that samples the performance variables of the MPI tools interface.
+//! The selected variables are bound in a private session after the MPI
+//! initialization, and they are read after the selected operations or
+//! periodically. Variables bound to communicators are bound to the world
+//! communicator, and variables with several elements report their sum
+class Pvars {
+public:
+    //! A bound performance variable and the summary of its samples. The
+    //! values are 64-bit integers or doubles depending on the variable type
+    struct Variable {
+        std::string _name;
+        int _index;
+        int _class;
+        MPI_Datatype _type;
+        int _count;
+        bool _double;
+        MPI_T_pvar_handle _handle;
+        uint64_t _samples;
+        uint64_t _min;
+        uint64_t _max;
+        uint64_t _last;
+    };
+
+private:
+    //! Whether the sampling is enabled
+    static bool _enabled;
+
+    //! The requested variable names
+    static std::vector<std::string> _names;
+
+    //! The operations after which the variables are sampled
+    static std::bitset<Operation::NumCodes> _operations;
+
+    //! The minimum time between periodic samples in nanoseconds, or zero if
+    //! the variables are not sampled periodically
+    static uint64_t _period;
+
+    //! The time of the next periodic sample
+    static std::atomic<uint64_t> _next;
+
+    //! The session and the bound variables
+    static MPI_T_pvar_session _session;
+    static std::vector<Variable> _variables;
+
+    //! The world communicator bound to the variables. The binding takes the
+    //! address of the handle
+    static MPI_Comm _world;
+
+    //! The lock serializing the accesses to the tools interface
+    static std::mutex _lock;
+
+    //! \brief Read the current value of a variable
+    static uint64_t read(Variable &variable);
+
+public:
+    //! \brief Configure the sampling before the MPI initialization
+    //!
+    //! \param names The comma-separated list of variable names
+    //! \param operations The operations after which the variables are sampled
+    //! \param period The minimum time between periodic samples in nanoseconds
+    static void configure(const std::string &names,
+                          const std::bitset<Operation::NumCodes> &operations,
+                          uint64_t period);
+
+    //! \brief Check whether any variable was requested
+    static bool requested()
+    {
+        return !_names.empty();
+    }
+
+    //! \brief Check whether the sampling is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Bind the requested variables after the MPI initialization
+    //!
+    //! The sampling is enabled if any variable could be bound
+    static void initialize();
+
+    //! \brief Get the bound variables
+    static const std::vector<Variable> &variables()
+    {
+        return _variables;
+    }
+
+    //! \brief Check whether the variables must be sampled after an operation
+    static bool due(Operation::Code operation)
+    {
+        if (_operations[operation])
+            return true;
+        return _period && Clock::now() >= _next.load(std::memory_order_relaxed);
+    }
+
+    //! \brief Sample all variables
+    //!
+    //! The sample is skipped if another thread is sampling
+    //!
+    //! \param func The function called with the index and value of each
+    //! variable
+    template <typename FuncTy>
+    static void sample(FuncTy func)
+    {
+        std::unique_lock<std::mutex> guard(_lock, std::try_to_lock);
+        if (!guard.owns_lock() || !_enabled)
+            return;
+
+        if (_period)
+            _next.store(Clock::now() + _period, std::memory_order_relaxed);
+
+        for (size_t v = 0; v < _variables.size(); ++v)
+            func(v, read(_variables[v]));
+    }
+
+    //! \brief Write the summary of the samples of each variable
+    //!
+    //! \param file The file where the summary is written
+    static void report(FILE *file);
+
+    //! \brief Free the variables and the session
+    //!
+    //! This function must be called before the MPI finalization
+    static void finalize();
+};
+
+} // namespace sonar
+
+#endif // PVARS_HPP
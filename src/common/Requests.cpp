@@ -0,0 +1,151 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include "IOHandler.hpp"
+#include "Requests.hpp"
+
+namespace sonar {
+
+bool Requests::_enabled = false;
+Requests::Entry *Requests::_table = nullptr;
+std::atomic<uint64_t> Requests::_untracked(0);
+thread_local std::vector<Requests::Pending> Requests::_pending;
+thread_local uint64_t Requests::_start = 0;
+
+void Requests::enable()
+{
+    _table = new Entry[Capacity]();
+    _enabled = true;
+}
+
+void Requests::insert(uintptr_t requestKey, Operation::Code operation,
+                      uint64_t posted, uint64_t blocked)
+{
+    size_t first = slot(requestKey);
+    for (size_t p = 0; p < MaxProbes; ++p) {
+        Entry &entry = _table[(first + p) % Capacity];
+
+        uintptr_t current = entry._key.load(std::memory_order_relaxed);
+        if (current != Empty && current != Deleted)
+            continue;
+        if (!entry._key.compare_exchange_strong(current, Reserved,
+                                                std::memory_order_acquire))
+            continue;
+
+        entry._operation = operation;
+        entry._posted = posted;
+        entry._blocked = blocked;
+        entry._key.store(requestKey, std::memory_order_release);
+        return;
+    }
+
+    if (_untracked.fetch_add(1, std::memory_order_relaxed) == 0)
+        IOHandler::warn("Some requests are not tracked, since the request table has no free "
+                        "entry near their slots");
+}
+
+void Requests::post(MPI_Request request, Operation::Code operation, uint64_t time)
+{
+    if (request == MPI_REQUEST_NULL || key(request) <= Reserved)
+        return;
+
+    insert(key(request), operation, time, 0);
+}
+
+Requests::Entry *Requests::reserve(uintptr_t requestKey)
+{
+    size_t first = slot(requestKey);
+    for (size_t p = 0; p < MaxProbes; ++p) {
+        Entry &entry = _table[(first + p) % Capacity];
+
+        uintptr_t current = entry._key.load(std::memory_order_acquire);
+        if (current == Empty)
+            return nullptr;
+        if (current != requestKey)
+            continue;
+        if (entry._key.compare_exchange_strong(current, Reserved,
+                                               std::memory_order_acquire))
+            return &entry;
+    }
+    return nullptr;
+}
+
+void Requests::remove(Entry &entry)
+{
+    Entry &next = _table[(&entry - _table + 1) % Capacity];
+    if (next._key.load(std::memory_order_acquire) != Empty) {
+        entry._key.store(Deleted, std::memory_order_release);
+        return;
+    }
+
+    entry._key.store(Empty, std::memory_order_release);
+
+    // A concurrent insertion may have taken the next entry, whose probing
+    // must continue past this one
+    uintptr_t expected = Empty;
+    if (next._key.load(std::memory_order_acquire) != Empty)
+        entry._key.compare_exchange_strong(expected, Deleted, std::memory_order_release,
+                                           std::memory_order_relaxed);
+}
+
+void Requests::forget(MPI_Request request)
+{
+    if (request == MPI_REQUEST_NULL || key(request) <= Reserved)
+        return;
+
+    Entry *entry = reserve(key(request));
+    if (entry != nullptr)
+        remove(*entry);
+}
+
+void Requests::add(MPI_Request request)
+{
+    Pending pending = {};
+    pending._request = request;
+
+    if (request != MPI_REQUEST_NULL && key(request) > Reserved) {
+        Entry *entry = reserve(key(request));
+        if (entry != nullptr) {
+            pending._tracked = true;
+            pending._operation = entry->_operation;
+            pending._posted = entry->_posted;
+            pending._blocked = entry->_blocked;
+            remove(*entry);
+        }
+    }
+    _pending.push_back(pending);
+}
+
+bool Requests::complete(size_t index, uint64_t time, Lifecycle &lifecycle)
+{
+    if (index >= _pending.size())
+        return false;
+
+    // The request is not blocked anymore and must not be put back
+    Pending &pending = _pending[index];
+    if (!pending._tracked)
+        return false;
+    pending._tracked = false;
+
+    lifecycle._operation = pending._operation;
+    lifecycle._latency = time - pending._posted;
+    lifecycle._blocked = pending._blocked + (time - _start);
+    return true;
+}
+
+void Requests::end(uint64_t time)
+{
+    uint64_t duration = time - _start;
+
+    for (const Pending &pending : _pending) {
+        if (pending._tracked)
+            insert(key(pending._request), pending._operation, pending._posted,
+                   pending._blocked + duration);
+    }
+    _pending.clear();
+}
+
+} // namespace sonar
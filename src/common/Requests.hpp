@@ -0,0 +1,184 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef REQUESTS_HPP
+#define REQUESTS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mpi.h>
+#include <vector>
+
+#include "Operation.hpp"
+#include "Utils.hpp"
+
+namespace sonar {
+
+//! Class that tracks the lifecycle of the requests of non-blocking operations.
+//! The posted requests are stored in a lock-free open addressing table keyed
+//! by the request handle, so they can be completed by any thread. The table
+//! has a fixed capacity and a bounded probing distance. Requests that do not
+//! fit are not tracked, and their number is reported
+//!
+//! A completion call takes the entries of its requests out of the table
+//! before calling MPI, and puts back the ones that did not complete. Once
+//! MPI releases a request, its handle may be returned by a concurrent post,
+//! so the entry of the released request must not be in the table anymore
+class Requests {
+public:
+    //! The lifecycle of a completed request
+    struct Lifecycle {
+        //! The operation that posted the request
+        Operation::Code _operation;
+        //! The time from the posting to the completion
+        uint64_t _latency;
+        //! The time spent in wait and test calls including the request
+        uint64_t _blocked;
+    };
+
+private:
+    //! An entry of the table. The key is the request handle or one of the
+    //! reserved values below. An entry is reserved while being written or
+    //! read, and published with release semantics
+    struct Entry {
+        std::atomic<uintptr_t> _key;
+        Operation::Code _operation;
+        uint64_t _posted;
+        uint64_t _blocked;
+    };
+
+    //! A request passed to the current completion call of a thread and its
+    //! entry taken from the table
+    struct Pending {
+        MPI_Request _request;
+        bool _tracked;
+        Operation::Code _operation;
+        uint64_t _posted;
+        uint64_t _blocked;
+    };
+
+    //! The reserved keys
+    static constexpr uintptr_t Empty = 0;
+    static constexpr uintptr_t Deleted = 1;
+    static constexpr uintptr_t Reserved = 2;
+
+    //! The number of entries of the table
+    static constexpr int CapacityBits = 16;
+    static constexpr size_t Capacity = 1 << CapacityBits;
+
+    //! The maximum number of entries probed for a request
+    static constexpr size_t MaxProbes = 64;
+
+    //! Whether the tracking is enabled
+    static bool _enabled;
+
+    //! The table of posted requests
+    static Entry *_table;
+
+    //! The number of requests that did not fit in the table
+    static std::atomic<uint64_t> _untracked;
+
+    //! The requests passed to the current completion call of each thread and
+    //! the time when the call started
+    static thread_local std::vector<Pending> _pending;
+    static thread_local uint64_t _start;
+
+    //! \brief Get the key of a request handle
+    static uintptr_t key(MPI_Request request)
+    {
+        return (uintptr_t) request;
+    }
+
+    //! \brief Get the first entry probed for a key
+    //!
+    //! All bits of the key are hashed, since the handles may be pointers or
+    //! integers with the index in the lowest bits
+    static size_t slot(uintptr_t key)
+    {
+        return Utils::mix(key) >> (64 - CapacityBits);
+    }
+
+    //! \brief Find and reserve the entry of a key
+    //!
+    //! \returns The entry or null if the key is not in the table
+    static Entry *reserve(uintptr_t key);
+
+    //! \brief Remove a reserved entry from the table
+    //!
+    //! The entry becomes empty if the next one is empty, since no probing
+    //! continues past it. Otherwise, it is marked as deleted
+    static void remove(Entry &entry);
+
+    //! \brief Insert an entry in a free slot of the table
+    //!
+    //! The entries of other requests are never replaced, even if they have
+    //! the same key. The request is counted as untracked if there is no free
+    //! slot within the probing distance
+    static void insert(uintptr_t key, Operation::Code operation, uint64_t posted, uint64_t blocked);
+
+public:
+    //! \brief Enable the tracking and allocate the table
+    static void enable();
+
+    //! \brief Check whether the tracking is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Get the number of requests that were not tracked
+    static uint64_t untracked()
+    {
+        return _untracked.load(std::memory_order_relaxed);
+    }
+
+    //! \brief Record a posted request
+    //!
+    //! \param request The request handle
+    //! \param operation The operation that posted the request
+    //! \param time The posting time
+    static void post(MPI_Request request, Operation::Code operation, uint64_t time);
+
+    //! \brief Remove a request without completing it
+    static void forget(MPI_Request request);
+
+    //! \brief Start a completion call of the current thread
+    //!
+    //! \param time The time when the call started
+    static void begin(uint64_t time)
+    {
+        _pending.clear();
+        _start = time;
+    }
+
+    //! \brief Add a request passed to the current completion call
+    //!
+    //! The entry of the request is taken out of the table until the call
+    //! finishes
+    static void add(MPI_Request request);
+
+    //! \brief Complete a request of the current completion call
+    //!
+    //! \param index The index of the request in the call
+    //! \param time The time when the call finished
+    //! \param lifecycle The lifecycle of the request if it was tracked
+    //!
+    //! \returns Whether the request was tracked
+    static bool complete(size_t index, uint64_t time, Lifecycle &lifecycle);
+
+    //! \brief Finish the current completion call
+    //!
+    //! The duration of the call is added to the blocked time of the requests
+    //! that were not completed, which are put back in the table
+    //!
+    //! \param time The time when the call finished
+    static void end(uint64_t time);
+};
+
+} // namespace sonar
+
+#endif // REQUESTS_HPP
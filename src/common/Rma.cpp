@@ -0,0 +1,44 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include "Rma.hpp"
+
+namespace sonar {
+
+bool Rma::_enabled = false;
+uint32_t Rma::_identifiers = 0;
+std::unordered_map<MPI_Win, uint32_t> Rma::_windows;
+std::mutex Rma::_lock;
+
+uint32_t Rma::create(MPI_Win window)
+{
+    if (window == MPI_WIN_NULL)
+        return 0;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    uint32_t id = ++_identifiers;
+
+    // Replace any stale entry of a window that was freed without our wrapper
+    _windows[window] = id;
+    Cache::invalidate();
+    return id;
+}
+
+void Rma::forget(MPI_Win window)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _windows.erase(window);
+    Cache::invalidate();
+}
+
+uint32_t Rma::lookup(MPI_Win window)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto it = _windows.find(window);
+    return (it != _windows.end()) ? it->second : 0;
+}
+
+} // namespace sonar
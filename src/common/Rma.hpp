@@ -0,0 +1,79 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef RMA_HPP
+#define RMA_HPP
+
+#include <cstdint>
+#include <mpi.h>
+#include <mutex>
+#include <unordered_map>
+
+#include "Utils.hpp"
+
+namespace sonar {
+
+//! Class that identifies the RMA windows from their creation until they are
+//! freed. Each window gets a process-wide identifier at its creation, so the
+//! accesses and synchronizations of the same window can be correlated even if
+//! its handle is reused after freeing it
+class Rma {
+private:
+    //! Whether the tracking is enabled
+    static bool _enabled;
+
+    //! The number of assigned identifiers
+    static uint32_t _identifiers;
+
+    //! The identifier of each window and the lock protecting them
+    static std::unordered_map<MPI_Win, uint32_t> _windows;
+    static std::mutex _lock;
+
+    //! The per-thread cache of identifiers, which avoids taking the lock in
+    //! the window accesses. Invalidated whenever a window is created or freed
+    using Cache = HandleCache<Rma, MPI_Win, uint32_t>;
+
+    //! \brief Find the identifier of a window in the shared table
+    static uint32_t lookup(MPI_Win window);
+
+public:
+    //! \brief Enable the tracking
+    static void enable()
+    {
+        _enabled = true;
+    }
+
+    //! \brief Check whether the tracking is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Record a created window
+    //!
+    //! \returns The identifier of the window
+    static uint32_t create(MPI_Win window);
+
+    //! \brief Remove a freed window
+    static void forget(MPI_Win window);
+
+    //! \brief Get the identifier of a window
+    //!
+    //! The lock is only taken the first time each thread accesses the window
+    //! after the last invalidation
+    //!
+    //! \returns The identifier or zero if the window is not tracked
+    static uint32_t identifier(MPI_Win window)
+    {
+        return Cache::get(window, [](MPI_Win handle, uint32_t &id) {
+            id = lookup(handle);
+        });
+    }
+};
+
+} // namespace sonar
+
+#endif // RMA_HPP
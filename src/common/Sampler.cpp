@@ -0,0 +1,83 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include "Envar.hpp"
+#include "IOHandler.hpp"
+#include "Sampler.hpp"
+
+namespace sonar {
+
+thread_local Sampler::ThreadState Sampler::_state;
+Sampler::Mode Sampler::_mode = Sampler::Disabled;
+uint64_t Sampler::_period = 1;
+double Sampler::_budget = 0;
+
+void Sampler::initialize()
+{
+    Envar<std::string> mode("SONAR_MPI_SAMPLING", "none");
+    Envar<uint64_t> period("SONAR_MPI_SAMPLING_PERIOD", 1);
+    Envar<double> budget("SONAR_MPI_OVERHEAD_BUDGET", 0);
+
+    if (mode.get() == "none")
+        _mode = Disabled;
+    else if (mode.get() == "periodic")
+        _mode = Periodic;
+    else if (mode.get() == "random")
+        _mode = Random;
+    else
+        IOHandler::fail("Invalid value ", mode.get(), " for ", mode.getName());
+
+    if (period.get() == 0 || period.get() > MaxPeriod)
+        IOHandler::fail("Invalid value ", period.get(), " for ", period.getName());
+
+    if (budget.get() < 0 || budget.get() >= 100)
+        IOHandler::fail("Invalid value ", budget.get(), " for ", budget.getName());
+
+    _period = period.get();
+    _budget = budget.get() / 100;
+
+    // The governor needs sampling to lower the tracing rate
+    if (_budget > 0 && _mode == Disabled)
+        _mode = Periodic;
+}
+
+bool Sampler::govern(bool traced, uint64_t cost, uint64_t now)
+{
+    ThreadState &state = _state;
+
+    // Estimate the overhead of each kind of call with a moving average
+    uint64_t &average = (traced) ? state._tracedCost : state._untracedCost;
+    average = (average) ? (average * 7 + cost) / 8 : cost;
+
+    if (state._epochStart == 0) {
+        state._epochStart = now;
+        state._epochTraced = 0;
+        state._epochUntraced = 0;
+        return false;
+    }
+
+    uint64_t elapsed = now - state._epochStart;
+    if (elapsed < EpochLength)
+        return false;
+
+    // The untraced calls still pay the wrapper and the sampling decision
+    double overhead = (double) (state._epochTraced * state._tracedCost
+                                + state._epochUntraced * state._untracedCost) / elapsed;
+
+    uint64_t previous = state._period;
+    if (overhead > _budget && state._period < MaxPeriod)
+        state._period *= 2;
+    else if (overhead < _budget / 4 && state._period / 2 >= _period)
+        state._period /= 2;
+
+    state._epochStart = now;
+    state._epochTraced = 0;
+    state._epochUntraced = 0;
+
+    return state._period != previous;
+}
+
+} // namespace sonar
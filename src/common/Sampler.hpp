@@ -0,0 +1,169 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef SAMPLER_HPP
+#define SAMPLER_HPP
+
+#include <cstdint>
+
+#include "Compat.hpp"
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that decides which calls are traced when sampling is enabled. The
+//! sampling period can be automatically increased by a governor that keeps
+//! the estimated instrumentation overhead of each thread under a budget
+class Sampler {
+public:
+    //! The sampling modes
+    enum Mode {
+        //! All calls are traced
+        Disabled = 0,
+        //! Every Nth call of each operation is traced
+        Periodic,
+        //! Each call is traced with probability 1/N
+        Random,
+    };
+
+private:
+    //! The length of the governor epochs in nanoseconds
+    static constexpr uint64_t EpochLength = 100000000;
+
+    //! The number of sampled calls between overhead measurements. It is odd
+    //! so the measured calls are not aligned with the power-of-two periods
+    //! and cover both traced and untraced calls
+    static constexpr uint64_t MeasurePeriod = 31;
+
+    //! The maximum sampling period set by the governor
+    static constexpr uint64_t MaxPeriod = 1ULL << 20;
+
+    //! The sampling state of a thread. It is zero-initialized, so a zero
+    //! period means the state was not initialized yet
+    struct ThreadState {
+        //! The current sampling period
+        uint64_t _period;
+        //! The calls of each operation since the last traced call
+        uint64_t _counters[Operation::NumCodes];
+        //! The state of the random generator
+        uint64_t _random;
+        //! The sampled calls since the thread started
+        uint64_t _calls;
+        //! Whether the overhead of the last sampled call must be measured
+        bool _measuring;
+        //! The start time of the current governor epoch
+        uint64_t _epochStart;
+        //! The traced and untraced calls in the current governor epoch
+        uint64_t _epochTraced;
+        uint64_t _epochUntraced;
+        //! The estimated instrumentation overhead of a traced and an
+        //! untraced call in nanoseconds
+        uint64_t _tracedCost;
+        uint64_t _untracedCost;
+    };
+
+    //! The sampling state of the current thread
+    static thread_local ThreadState _state;
+
+    //! The sampling mode
+    static Mode _mode;
+
+    //! The initial sampling period
+    static uint64_t _period;
+
+    //! The overhead budget as a fraction of the run-time, or zero if the
+    //! governor is disabled
+    static double _budget;
+
+    //! \brief Initialize the sampling state of the current thread
+    static void initializeThread(ThreadState &state)
+    {
+        state._period = _period;
+        state._random = ((uint64_t) gettid() << 32) | 0x9e3779b9;
+    }
+
+    //! \brief Generate the next pseudo-random number of the thread
+    static uint64_t random(ThreadState &state)
+    {
+        // Xorshift64 generator
+        uint64_t x = state._random;
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        state._random = x;
+        return x;
+    }
+
+public:
+    //! \brief Read the sampling configuration
+    static void initialize();
+
+    //! \brief Check whether sampling is enabled
+    static bool enabled()
+    {
+        return _mode != Disabled;
+    }
+
+    //! \brief Get the sampling period of the current thread
+    static uint64_t period()
+    {
+        return (_state._period) ? _state._period : _period;
+    }
+
+    //! \brief Decide whether the current call of an operation is traced
+    template <Operation::Code Code>
+    static bool sample()
+    {
+        ThreadState &state = _state;
+        if (__builtin_expect(state._period == 0, 0))
+            initializeThread(state);
+
+        bool sampled;
+        if (_mode == Periodic) {
+            sampled = (++state._counters[Code] >= state._period);
+            if (sampled)
+                state._counters[Code] = 0;
+        } else {
+            sampled = (random(state) % state._period == 0);
+        }
+
+        if (sampled)
+            ++state._epochTraced;
+        else
+            ++state._epochUntraced;
+
+        state._measuring = (_budget > 0 && ++state._calls % MeasurePeriod == 0);
+        return sampled;
+    }
+
+    //! \brief Check whether the overhead of the current call should be
+    //! measured by the governor
+    //!
+    //! The decision is consumed, so the calls that are not sampled, such as
+    //! the filtered ones, are never measured
+    static bool measuring()
+    {
+        if (!_state._measuring)
+            return false;
+
+        _state._measuring = false;
+        return true;
+    }
+
+    //! \brief Update the governor with the measured overhead of a call
+    //!
+    //! \param traced Whether the call was traced
+    //! \param cost The instrumentation time of the call, which excludes the
+    //! time in the wrapped function
+    //! \param now The current time
+    //!
+    //! \returns Whether the sampling period of the thread changed
+    static bool govern(bool traced, uint64_t cost, uint64_t now);
+};
+
+} // namespace sonar
+
+#endif // SAMPLER_HPP
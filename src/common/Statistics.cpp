@@ -0,0 +1,121 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include "Pvars.hpp"
+#include "Requests.hpp"
+#include "Statistics.hpp"
+
+namespace sonar {
+
+thread_local Statistics::ThreadStatistics *Statistics::_thread = nullptr;
+std::vector<Statistics::ThreadStatistics *> Statistics::_threads;
+std::mutex Statistics::_lock;
+int Statistics::_rank = 0;
+int Statistics::_nranks = 1;
+
+Statistics::ThreadStatistics::ThreadStatistics() :
+    _counters(),
+    _requests()
+{
+    for (auto &versions : _counters)
+        for (Counters &counters : versions)
+            counters._min.store(UINT64_MAX, std::memory_order_relaxed);
+}
+
+Statistics::ThreadStatistics *Statistics::registerThread()
+{
+    _thread = new ThreadStatistics();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _threads.push_back(_thread);
+
+    return _thread;
+}
+
+void Statistics::finalize(const std::string &directory)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    std::string path = directory + "/sonar-mpi-stats." + std::to_string(_rank) + ".txt";
+
+    FILE *file = fopen(path.c_str(), "w");
+    if (file == nullptr)
+        IOHandler::fail("Could not open the statistics file ", path);
+
+    fprintf(file, "# Sonar MPI statistics of rank %d of %d with %zu threads\n",
+            _rank, _nranks, _threads.size());
+    fprintf(file, "# operation version calls total_ns min_ns max_ns [log2_bucket:calls]...\n");
+    fprintf(file, "# operation requests completed latency_ns blocked_ns hidden_ns\n");
+
+    for (int code = 0; code < Operation::NumCodes; ++code) {
+        for (int version = 0; version < Operation::NumVersions; ++version) {
+            uint64_t calls = 0, time = 0, min = UINT64_MAX, max = 0;
+            uint64_t histogram[NumBuckets] = {};
+
+            for (ThreadStatistics *stats : _threads) {
+                const Counters &counters = stats->_counters[code][version];
+                calls += counters._calls.load(std::memory_order_relaxed);
+                time += counters._time.load(std::memory_order_relaxed);
+                min = std::min(min, counters._min.load(std::memory_order_relaxed));
+                max = std::max(max, counters._max.load(std::memory_order_relaxed));
+
+                for (int b = 0; b < NumBuckets; ++b)
+                    histogram[b] += counters._histogram[b].load(std::memory_order_relaxed);
+            }
+
+            if (calls == 0)
+                continue;
+
+            fprintf(file, "%s %s %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64, Operation::Names[code],
+                    Operation::VersionNames[version], calls, time, min, max);
+
+            for (int b = 0; b < NumBuckets; ++b)
+                if (histogram[b])
+                    fprintf(file, " %d:%" PRIu64, b, histogram[b]);
+            fprintf(file, "\n");
+        }
+    }
+
+    for (int code = 0; code < Operation::NumCodes; ++code) {
+        uint64_t completed = 0, latency = 0, blocked = 0;
+
+        for (ThreadStatistics *stats : _threads) {
+            const RequestCounters &counters = stats->_requests[code];
+            completed += counters._completed.load(std::memory_order_relaxed);
+            latency += counters._latency.load(std::memory_order_relaxed);
+            blocked += counters._blocked.load(std::memory_order_relaxed);
+        }
+
+        if (completed == 0)
+            continue;
+
+        fprintf(file, "%s requests %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 "\n",
+                Operation::Names[code], completed, latency, blocked, latency - blocked);
+    }
+
+    // The requests that did not fit in the tracking table are missing from
+    // the request lifecycles above
+    if (Requests::enabled())
+        fprintf(file, "# untracked requests %" PRIu64 "\n", Requests::untracked());
+
+    // The summaries of the sampled performance variables
+    if (!Pvars::variables().empty())
+        Pvars::report(file);
+
+    if (fclose(file))
+        IOHandler::fail("Could not write the statistics file ", path);
+
+    for (ThreadStatistics *stats : _threads)
+        delete stats;
+    _threads.clear();
+    _thread = nullptr;
+}
+
+} // namespace sonar
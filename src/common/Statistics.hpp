@@ -0,0 +1,134 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef STATISTICS_HPP
+#define STATISTICS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "IOHandler.hpp"
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that computes in-memory statistics of the operations. Each thread
+//! updates its own counters without any synchronization, and the counters of
+//! all threads are aggregated and written in a per-rank file at finalization
+class Statistics {
+private:
+    //! The number of log2 buckets of the duration histograms
+    static constexpr int NumBuckets = 64;
+
+    //! The counters of an operation variant. The counters are only modified
+    //! by the owner thread, so relaxed loads and stores are enough
+    struct Counters {
+        std::atomic<uint64_t> _calls;
+        std::atomic<uint64_t> _time;
+        std::atomic<uint64_t> _min;
+        std::atomic<uint64_t> _max;
+        std::atomic<uint64_t> _histogram[NumBuckets];
+    };
+
+    //! The counters of the completed requests of a non-blocking operation
+    struct RequestCounters {
+        std::atomic<uint64_t> _completed;
+        std::atomic<uint64_t> _latency;
+        std::atomic<uint64_t> _blocked;
+    };
+
+    //! The counters of all operation variants of a thread
+    struct ThreadStatistics {
+        Counters _counters[Operation::NumCodes][Operation::NumVersions];
+        RequestCounters _requests[Operation::NumCodes];
+
+        ThreadStatistics();
+    };
+
+    //! The statistics of the current thread
+    static thread_local ThreadStatistics *_thread;
+
+    //! The statistics of all threads and the lock protecting them
+    static std::vector<ThreadStatistics *> _threads;
+    static std::mutex _lock;
+
+    //! The rank of the process and the number of ranks
+    static int _rank;
+    static int _nranks;
+
+    //! \brief Add a value to a counter owned by the current thread
+    static void add(std::atomic<uint64_t> &counter, uint64_t value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value,
+                      std::memory_order_relaxed);
+    }
+
+    //! \brief Allocate and register the statistics of the current thread
+    static ThreadStatistics *registerThread();
+
+public:
+    //! \brief Set the process information
+    //!
+    //! \param rank The rank of the process
+    //! \param nranks The number of processes
+    static void initialize(int rank, int nranks)
+    {
+        _rank = rank;
+        _nranks = nranks;
+    }
+
+    //! \brief Record a call of an operation variant
+    //!
+    //! \param duration The duration of the call in nanoseconds
+    template <Operation::Code Code, Operation::Count Count>
+    static void record(uint64_t duration)
+    {
+        ThreadStatistics *stats = _thread;
+        if (__builtin_expect(stats == nullptr, 0))
+            stats = registerThread();
+
+        Counters &counters = stats->_counters[Code][Count];
+        add(counters._calls, 1);
+        add(counters._time, duration);
+
+        if (duration < counters._min.load(std::memory_order_relaxed))
+            counters._min.store(duration, std::memory_order_relaxed);
+        if (duration > counters._max.load(std::memory_order_relaxed))
+            counters._max.store(duration, std::memory_order_relaxed);
+
+        int bucket = (duration) ? 64 - __builtin_clzll(duration) : 0;
+        add(counters._histogram[(bucket < NumBuckets) ? bucket : NumBuckets - 1], 1);
+    }
+
+    //! \brief Record a completed request
+    //!
+    //! \param operation The operation that posted the request
+    //! \param latency The time from the posting to the completion
+    //! \param blocked The time spent in wait and test calls
+    static void request(Operation::Code operation, uint64_t latency, uint64_t blocked)
+    {
+        ThreadStatistics *stats = _thread;
+        if (__builtin_expect(stats == nullptr, 0))
+            stats = registerThread();
+
+        RequestCounters &counters = stats->_requests[operation];
+        add(counters._completed, 1);
+        add(counters._latency, latency);
+        add(counters._blocked, blocked);
+    }
+
+    //! \brief Write the aggregated statistics of the process and free them
+    //!
+    //! \param directory The directory where the profile is written
+    static void finalize(const std::string &directory);
+};
+
+} // namespace sonar
+
+#endif // STATISTICS_HPP
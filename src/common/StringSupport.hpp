@@ -36,6 +36,24 @@ public:
         value = tmp;
         return true;
     }
+
+    //! \brief Parse a string to a boolean
+    //!
+    //! Accepts the values 1, true and yes, and 0, false and no
+    static bool parse(const std::string &str, bool &value)
+    {
+        std::string lower = str;
+        std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+
+        if (lower == "1" || lower == "true" || lower == "yes")
+            value = true;
+        else if (lower == "0" || lower == "false" || lower == "no")
+            value = false;
+        else
+            return false;
+
+        return true;
+    }
 };
 
 } // namespace sonar
@@ -0,0 +1,214 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <elf.h>
+#include <link.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <unordered_map>
+#include <vector>
+
+#include "Symbol.hpp"
+
+namespace sonar {
+
+Symbol::Entry *Symbol::_entries = nullptr;
+
+namespace {
+
+//! The relocations of the calls and the address references to the functions
+//! of other objects. The PMPI build and other architectures are not rebound
+#if defined(SONAR_PMPI)
+#elif defined(__x86_64__)
+constexpr uint32_t JumpSlot = R_X86_64_JUMP_SLOT;
+constexpr uint32_t GlobalData = R_X86_64_GLOB_DAT;
+#define SONAR_REBIND
+#elif defined(__aarch64__)
+constexpr uint32_t JumpSlot = R_AARCH64_JUMP_SLOT;
+constexpr uint32_t GlobalData = R_AARCH64_GLOB_DAT;
+#define SONAR_REBIND
+#endif
+
+#ifdef SONAR_REBIND
+
+//! The state shared by the rebinding of all objects
+struct Rebinding {
+    //! The handle of the Sonar library, which looks up its own definitions
+    void *_handle;
+    //! The address of a function of the Sonar library
+    uintptr_t _self;
+    //! The targets indexed by the addresses of their wrappers
+    std::unordered_map<void *, void *> _targets;
+};
+
+//! \brief Check whether an address belongs to a loaded object
+bool contains(const dl_phdr_info *info, uintptr_t address)
+{
+    for (int i = 0; i < info->dlpi_phnum; ++i) {
+        const ElfW(Phdr) &phdr = info->dlpi_phdr[i];
+        uintptr_t start = info->dlpi_addr + phdr.p_vaddr;
+        if (phdr.p_type == PT_LOAD && address >= start && address < start + phdr.p_memsz)
+            return true;
+    }
+    return false;
+}
+
+//! \brief Get the address of a dynamic entry, which the loader usually
+//! relocates in place
+uintptr_t dynamicAddress(const dl_phdr_info *info, ElfW(Addr) ptr)
+{
+    return (ptr < info->dlpi_addr) ? info->dlpi_addr + ptr : ptr;
+}
+
+//! \brief Rebind the relocations of a loaded object
+int rebindObject(dl_phdr_info *info, size_t, void *data)
+{
+    Rebinding &rebinding = *static_cast<Rebinding *>(data);
+
+    // The wrappers call the targets through their own loaded addresses
+    if (contains(info, rebinding._self))
+        return 0;
+
+    const ElfW(Dyn) *dynamic = nullptr;
+    uintptr_t relroStart = 0, relroEnd = 0;
+    for (int i = 0; i < info->dlpi_phnum; ++i) {
+        const ElfW(Phdr) &phdr = info->dlpi_phdr[i];
+        if (phdr.p_type == PT_DYNAMIC) {
+            dynamic = (const ElfW(Dyn) *) (info->dlpi_addr + phdr.p_vaddr);
+        } else if (phdr.p_type == PT_GNU_RELRO) {
+            relroStart = info->dlpi_addr + phdr.p_vaddr;
+            relroEnd = relroStart + phdr.p_memsz;
+        }
+    }
+    if (dynamic == nullptr)
+        return 0;
+
+    const ElfW(Sym) *symbols = nullptr;
+    const char *strings = nullptr;
+    const ElfW(Rela) *relocs[2] = { nullptr, nullptr };
+    size_t sizes[2] = { 0, 0 };
+    for (const ElfW(Dyn) *entry = dynamic; entry->d_tag != DT_NULL; ++entry) {
+        switch (entry->d_tag) {
+        case DT_SYMTAB:
+            symbols = (const ElfW(Sym) *) dynamicAddress(info, entry->d_un.d_ptr);
+            break;
+        case DT_STRTAB:
+            strings = (const char *) dynamicAddress(info, entry->d_un.d_ptr);
+            break;
+        case DT_RELA:
+            relocs[0] = (const ElfW(Rela) *) dynamicAddress(info, entry->d_un.d_ptr);
+            break;
+        case DT_RELASZ:
+            sizes[0] = entry->d_un.d_val;
+            break;
+        case DT_JMPREL:
+            relocs[1] = (const ElfW(Rela) *) dynamicAddress(info, entry->d_un.d_ptr);
+            break;
+        case DT_PLTRELSZ:
+            sizes[1] = entry->d_un.d_val;
+            break;
+        case DT_PLTREL:
+            // Both architectures only use relocations with addends
+            if (entry->d_un.d_val != DT_RELA)
+                return 0;
+            break;
+        }
+    }
+    if (symbols == nullptr || strings == nullptr)
+        return 0;
+
+    // The loader makes the pages fully inside the relocation read-only range
+    // read-only, like glibc's _dl_protect_relro. The last page is left
+    // writable if it also holds writable data, so it is not protected again
+    uintptr_t pageSize = sysconf(_SC_PAGESIZE);
+    uintptr_t protectedStart = relroStart & ~(pageSize - 1);
+    uintptr_t protectedEnd = relroEnd & ~(pageSize - 1);
+
+    // The protected pages that were made writable to patch their slots
+    std::vector<uintptr_t> unprotected;
+
+    for (int r = 0; r < 2; ++r) {
+        size_t count = sizes[r] / sizeof(ElfW(Rela));
+        for (size_t i = 0; i < count; ++i) {
+            const ElfW(Rela) &reloc = relocs[r][i];
+            uint32_t type = ELF64_R_TYPE(reloc.r_info);
+            size_t index = ELF64_R_SYM(reloc.r_info);
+            if ((type != JumpSlot && type != GlobalData) || index == 0)
+                continue;
+
+            // All wrappers intercept MPI interfaces, so the other symbols
+            // are not looked up
+            const ElfW(Sym) &symbol = symbols[index];
+            const char *name = strings + symbol.st_name;
+            if (symbol.st_shndx != SHN_UNDEF || strncasecmp(name, "mpi_", 4) != 0)
+                continue;
+
+            void *wrapper = dlsym(rebinding._handle, name);
+            auto it = rebinding._targets.find(wrapper);
+            if (it == rebinding._targets.end())
+                continue;
+
+            // Rebind the relocations bound to the wrapper and the lazy ones
+            // that will be bound to it. Other tools may intercept the same
+            // interfaces before the Sonar library
+            void **slot = (void **) (info->dlpi_addr + reloc.r_offset);
+            if (*slot != wrapper) {
+                bool lazy = (type == JumpSlot && contains(info, (uintptr_t) *slot));
+                if (!lazy || dlsym(RTLD_DEFAULT, name) != wrapper)
+                    continue;
+            }
+
+            uintptr_t page = (uintptr_t) slot & ~(pageSize - 1);
+            if (page >= protectedStart && page < protectedEnd
+                    && std::find(unprotected.begin(), unprotected.end(), page) == unprotected.end()) {
+                if (mprotect((void *) page, pageSize, PROT_READ | PROT_WRITE))
+                    continue;
+                unprotected.push_back(page);
+            }
+            *slot = it->second;
+        }
+    }
+
+    for (uintptr_t page : unprotected)
+        mprotect((void *) page, pageSize, PROT_READ);
+
+    return 0;
+}
+
+#endif // SONAR_REBIND
+
+} // namespace
+
+void Symbol::rebindAll([[maybe_unused]] const std::vector<std::pair<Entry *, void *>> &loaded)
+{
+#ifdef SONAR_REBIND
+    Dl_info info;
+    if (!dladdr((void *) &rebindObject, &info))
+        return;
+
+    Rebinding rebinding;
+    rebinding._handle = dlopen(info.dli_fname, RTLD_LAZY | RTLD_NOLOAD);
+    rebinding._self = (uintptr_t) &rebindObject;
+    if (rebinding._handle == nullptr)
+        return;
+
+    // The wrappers are the definitions of the Sonar library, which are found
+    // before the ones of its dependencies
+    for (auto [entry, address] : loaded) {
+        void *wrapper = dlsym(rebinding._handle, entry->_name);
+        if (wrapper != nullptr)
+            rebinding._targets.emplace(wrapper, address);
+    }
+
+    dl_iterate_phdr(&rebindObject, &rebinding);
+    dlclose(rebinding._handle);
+#endif
+}
+
+} // namespace sonar
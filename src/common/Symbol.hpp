@@ -8,6 +8,8 @@
 #define SYMBOL_HPP
 
 #include <dlfcn.h>
+#include <utility>
+#include <vector>
 
 #include "IOHandler.hpp"
 
@@ -15,18 +17,111 @@ namespace sonar {
 
 //! Class that allows the dynamic loading of symbols at run-time
 class Symbol {
+private:
+    //! Entry of the list of targets that are loaded at initialization
+    struct Entry {
+        //! The name of the symbol
+        const char *_name;
+        //! The function that loads the symbol and returns its address
+        void *(*_load)(Entry *);
+        //! Whether the callers of the wrapper must not be rebound
+        bool _pinned;
+        //! The next entry of the list
+        Entry *_next;
+    };
+
+    //! The list of targets to load
+    static Entry *_entries;
+
+    //! \brief Rebind the callers of the wrappers to the loaded targets
+    //!
+    //! The relocations of the other loaded objects that refer to a wrapper
+    //! are overwritten with the address of its target, so their calls skip
+    //! the wrapper. Only the targets of the given list are rebound
+    static void rebindAll(const std::vector<std::pair<Entry *, void *>> &loaded);
+
 public:
-    //! \brief Load a symbol from the subsequent libraries
+    //! Class storing the address of the function called by a wrapper
+    //!
+    //! In the default build, the targets are registered at construction and
+    //! loaded at once when the MPI initialization is intercepted. In the PMPI
+    //! build, the targets are constant and point to the profiling symbols
+    template <typename FuncTy>
+    class Target : private Entry {
+    private:
+        //! The address of the function
+        FuncTy *_address;
+
+        //! \brief Load the symbol of a target entry
+        static void *load(Entry *entry)
+        {
+            Target *target = static_cast<Target *>(entry);
+            target->_address = (FuncTy *) dlsym(RTLD_NEXT, target->_name);
+            return (void *) target->_address;
+        }
+
+    public:
+#ifdef SONAR_PMPI
+        //! \brief Construct a target from its profiling symbol
+        constexpr Target(const char *name, FuncTy *address, bool pinned = false) :
+            Entry{ name, nullptr, pinned, nullptr },
+            _address(address)
+        {
+        }
+#else
+        //! \brief Construct and register a target to load
+        //!
+        //! The callers of a pinned target always go through its wrapper
+        Target(const char *name, bool pinned = false) :
+            Entry{ name, &load, pinned, _entries },
+            _address(nullptr)
+        {
+            _entries = this;
+        }
+#endif
+
+        //! \brief Load the symbol on demand or fail if it does not exist
+        __attribute__((noinline, cold))
+        FuncTy *resolve()
+        {
+            load(this);
+            if (_address == nullptr)
+                IOHandler::fail("Could not find symbol ", _name);
+            return _address;
+        }
+
+    public:
+        //! \brief Get the address of the function
+        //!
+        //! The symbol is loaded on demand if the function is called before
+        //! the MPI initialization
+        FuncTy *get()
+        {
+#ifndef SONAR_PMPI
+            if (__builtin_expect(_address == nullptr, 0))
+                return resolve();
+#endif
+            return _address;
+        }
+    };
+
+    //! \brief Load all registered targets from the subsequent libraries
     //!
-    //! \param name The name of the symbol to load
-    template <typename Func>
-    static Func *load(const char *name)
+    //! Symbols that are not found are left unresolved, since the wrapped
+    //! libraries may not provide all interfaces (e.g., Fortran). They fail
+    //! when called. When rebinding, the objects loaded at this point call
+    //! the targets that are not pinned directly instead of their wrappers
+    static void loadAll(bool rebind)
     {
-        Func *symbol = (Func *) dlsym(RTLD_NEXT, name);
-        if (symbol == nullptr)
-            IOHandler::fail("Could not find symbol ", name);
+        std::vector<std::pair<Entry *, void *>> loaded;
+        for (Entry *entry = _entries; entry != nullptr; entry = entry->_next) {
+            void *address = entry->_load(entry);
+            if (rebind && address != nullptr && !entry->_pinned)
+                loaded.emplace_back(entry, address);
+        }
 
-        return symbol;
+        if (!loaded.empty())
+            rebindAll(loaded);
     }
 };
 
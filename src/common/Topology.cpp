@@ -0,0 +1,62 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include "IOHandler.hpp"
+#include "Topology.hpp"
+
+namespace sonar {
+
+bool Topology::_enabled = false;
+std::unordered_set<int32_t> Topology::_reported;
+std::mutex Topology::_lock;
+
+void Topology::query(int32_t comm, Neighbors &neighbors)
+{
+    MPI_Comm handle = MPI_Comm_f2c(comm);
+    neighbors._sources.clear();
+    neighbors._destinations.clear();
+
+    int status;
+    if (PMPI_Topo_test(handle, &status) != MPI_SUCCESS)
+        IOHandler::fail("Could not retrieve the topology of a communicator");
+
+    if (status == MPI_CART) {
+        // The neighbors of each dimension are the ones in the negative and
+        // positive directions, which may be MPI_PROC_NULL
+        int ndims;
+        PMPI_Cartdim_get(handle, &ndims);
+        for (int d = 0; d < ndims; ++d) {
+            int source, destination;
+            if (PMPI_Cart_shift(handle, d, 1, &source, &destination) != MPI_SUCCESS)
+                IOHandler::fail("Could not retrieve the neighbors of a communicator");
+            neighbors._sources.push_back(source);
+            neighbors._sources.push_back(destination);
+        }
+        neighbors._destinations = neighbors._sources;
+    } else if (status == MPI_GRAPH) {
+        int rank, count;
+        PMPI_Comm_rank(handle, &rank);
+        PMPI_Graph_neighbors_count(handle, rank, &count);
+
+        std::vector<int> ranks(count);
+        if (PMPI_Graph_neighbors(handle, rank, count, ranks.data()) != MPI_SUCCESS)
+            IOHandler::fail("Could not retrieve the neighbors of a communicator");
+        neighbors._sources.assign(ranks.begin(), ranks.end());
+        neighbors._destinations = neighbors._sources;
+    } else if (status == MPI_DIST_GRAPH) {
+        int indegree, outdegree, weighted;
+        PMPI_Dist_graph_neighbors_count(handle, &indegree, &outdegree, &weighted);
+
+        std::vector<int> sources(indegree), destinations(outdegree);
+        if (PMPI_Dist_graph_neighbors(handle, indegree, sources.data(), MPI_UNWEIGHTED,
+                                      outdegree, destinations.data(), MPI_UNWEIGHTED) != MPI_SUCCESS)
+            IOHandler::fail("Could not retrieve the neighbors of a communicator");
+        neighbors._sources.assign(sources.begin(), sources.end());
+        neighbors._destinations.assign(destinations.begin(), destinations.end());
+    }
+}
+
+} // namespace sonar
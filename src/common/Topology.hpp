@@ -0,0 +1,113 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef TOPOLOGY_HPP
+#define TOPOLOGY_HPP
+
+#include <cstdint>
+#include <mpi.h>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "Utils.hpp"
+
+namespace sonar {
+
+//! Class that caches the neighbors of the topology communicators, so the
+//! neighborhood collectives do not query the topology at each call. Each
+//! thread caches the neighbors of the communicators it used, indexed by their
+//! identifier. The neighbors of each communicator are reported once per
+//! process
+class Topology {
+public:
+    //! The neighbors of a communicator in the order of the neighborhood
+    //! collectives
+    struct Neighbors {
+        //! Whether the current thread already checked the report
+        bool _reported;
+        std::vector<int32_t> _sources;
+        std::vector<int32_t> _destinations;
+    };
+
+private:
+    //! Whether the cache is enabled
+    static bool _enabled;
+
+    //! The per-thread cache of neighbors
+    using Cache = HandleCache<Topology, int32_t, Neighbors>;
+
+    //! The communicators whose neighbors were reported and the lock
+    //! protecting them
+    static std::unordered_set<int32_t> _reported;
+    static std::mutex _lock;
+
+    //! \brief Query the neighbors of a communicator
+    static void query(int32_t comm, Neighbors &neighbors);
+
+    //! \brief Get the cached neighbors of a communicator
+    static Neighbors &cached(int32_t comm)
+    {
+        return Cache::get(comm, &query);
+    }
+
+public:
+    //! \brief Enable the cache
+    static void enable()
+    {
+        _enabled = true;
+    }
+
+    //! \brief Check whether the cache is enabled
+    static bool enabled()
+    {
+        return _enabled;
+    }
+
+    //! \brief Get the neighbors of a communicator
+    //!
+    //! Communicators without topology have no neighbors. The neighbors are
+    //! valid until the next query of the current thread
+    //!
+    //! \param comm The communicator identifier
+    static const Neighbors &neighbors(int32_t comm)
+    {
+        return cached(comm);
+    }
+
+    //! \brief Check whether the neighbors of a communicator must be reported
+    //!
+    //! \param comm The communicator identifier
+    //!
+    //! \returns Whether this is the first check of the communicator in the
+    //! process since it was created
+    static bool report(int32_t comm)
+    {
+        Neighbors &neighbors = cached(comm);
+        if (neighbors._reported)
+            return false;
+        neighbors._reported = true;
+
+        std::lock_guard<std::mutex> guard(_lock);
+        return _reported.insert(comm).second;
+    }
+
+    //! \brief Release a freed communicator
+    //!
+    //! The cached neighbors of all threads are invalidated
+    static void release(int32_t comm)
+    {
+        {
+            std::lock_guard<std::mutex> guard(_lock);
+            _reported.erase(comm);
+        }
+        Cache::invalidate();
+    }
+};
+
+} // namespace sonar
+
+#endif // TOPOLOGY_HPP
@@ -7,8 +7,13 @@
 #ifndef UTILS_HPP
 #define UTILS_HPP
 
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <unistd.h>
+#include <unordered_map>
 
 #include "IOHandler.hpp"
 
@@ -27,8 +32,135 @@ public:
 
         return hostname;
     }
+
+    //! \brief Mix the bits of a value with the splitmix64 finalizer
+    //!
+    //! Every bit of the result depends on all bits of the value, so it can
+    //! be used to hash handles and to combine identifiers
+    static uint64_t mix(uint64_t value)
+    {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
 };
 
+//! Class that caches per thread the values derived from MPI handles, so the
+//! wrappers only compute them the first time each thread uses a handle. A
+//! freed handle can be reused by the MPI library, so the caches of all threads
+//! are invalidated through a global epoch. Each thread clears its cache when it
+//! observes a new epoch or when the cache is full, so the cache only holds the
+//! handles used since then
+//!
+//! \tparam Owner The class owning the cache, which separates the caches with
+//! the same key and value types
+//! \tparam Key The handle type
+//! \tparam Value The cached type, which is value-initialized on insertion
+template <typename Owner, typename Key, typename Value>
+class HandleCache {
+private:
+    //! The maximum number of handles of each per-thread cache
+    static constexpr size_t Capacity = 256;
+
+    //! The cache of a thread and its last found value, which avoids the
+    //! hashing when a thread uses the same handle repeatedly
+    struct Local {
+        uint64_t _epoch;
+        std::unordered_map<Key, Value> _values;
+        Key _lastKey;
+        Value *_last;
+    };
+
+    //! The current epoch
+    static std::atomic<uint64_t> _epoch;
+
+    //! The cache of the current thread
+    static thread_local Local _local;
+
+    //! \brief Remove all values of the current thread
+    static void clear(Local &local)
+    {
+        local._values.clear();
+        local._last = nullptr;
+    }
+
+public:
+    //! \brief Find the cached value of a handle
+    //!
+    //! \returns The value or null if the current thread has no valid value.
+    //! The value remains valid until the next call to the cache
+    static Value *find(const Key &key)
+    {
+        Local &local = _local;
+
+        uint64_t epoch = _epoch.load(std::memory_order_acquire);
+        if (local._epoch != epoch) {
+            clear(local);
+            local._epoch = epoch;
+        } else if (local._last != nullptr && local._lastKey == key) {
+            return local._last;
+        }
+
+        auto it = local._values.find(key);
+        if (it == local._values.end())
+            return nullptr;
+
+        local._lastKey = key;
+        local._last = &it->second;
+        return local._last;
+    }
+
+    //! \brief Insert the value of a handle not found in the cache
+    //!
+    //! \returns The value to be filled by the caller. The value remains valid
+    //! until the next call to the cache
+    static Value &insert(const Key &key)
+    {
+        Local &local = _local;
+        if (local._values.size() >= Capacity)
+            clear(local);
+
+        local._lastKey = key;
+        local._last = &local._values[key];
+        return *local._last;
+    }
+
+    //! \brief Get the value of a handle, filling it if not cached
+    //!
+    //! \param key The handle
+    //! \param fill The function filling the value given the handle and the
+    //! value-initialized value
+    //!
+    //! \returns The value, which remains valid until the next call to the cache
+    template <typename Fill>
+    static Value &get(const Key &key, Fill fill)
+    {
+        Value *value = find(key);
+        if (value != nullptr)
+            return *value;
+
+        Value &inserted = insert(key);
+        fill(key, inserted);
+        return inserted;
+    }
+
+    //! \brief Invalidate the cached values of all threads
+    //!
+    //! Must be called whenever a handle is freed or a handle that could have
+    //! been cached gets a new value
+    static void invalidate()
+    {
+        _epoch.fetch_add(1, std::memory_order_release);
+    }
+};
+
+// Start at one so the zero-initialized caches are never valid
+template <typename Owner, typename Key, typename Value>
+std::atomic<uint64_t> HandleCache<Owner, Key, Value>::_epoch(1);
+
+template <typename Owner, typename Key, typename Value>
+thread_local typename HandleCache<Owner, Key, Value>::Local HandleCache<Owner, Key, Value>::_local{};
+
 } // namespace sonar
 
 #endif // UTILS_HPP
@@ -0,0 +1,110 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#include <csignal>
+
+#include "Envar.hpp"
+#include "IOHandler.hpp"
+#include "Window.hpp"
+
+namespace sonar {
+
+std::atomic<bool> Window::_active(true);
+std::atomic<bool> Window::_pending(false);
+Window::Trigger Window::_start;
+Window::Trigger Window::_end;
+
+bool Window::arm(Trigger &trigger, const char *time, const char *call, uint64_t origin)
+{
+    Envar<double> seconds(time, 0);
+    Envar<std::string> calls(call, "");
+
+    if (seconds.get() < 0)
+        IOHandler::fail("Invalid value ", seconds.get(), " for ", seconds.getName());
+
+    trigger._time = (seconds.get() > 0) ? origin + (uint64_t) (seconds.get() * 1e9) : 0;
+    trigger._operation = Operation::NumCodes;
+    trigger._calls = 0;
+
+    // The calls are specified as the operation name and the call number
+    // separated by a colon
+    const std::string &value = calls.get();
+    if (!value.empty()) {
+        size_t colon = value.find(':');
+        if (colon != std::string::npos) {
+            trigger._operation = Operation::find(value.substr(0, colon).c_str());
+            StringSupport::parse(value.substr(colon + 1), trigger._calls);
+        }
+        if (trigger._operation == Operation::NumCodes || trigger._calls == 0)
+            IOHandler::fail("Invalid value ", value, " for ", calls.getName());
+    }
+
+    trigger._armed = (trigger._time || trigger._calls);
+    return trigger._armed;
+}
+
+bool Window::fires(Trigger &trigger, Operation::Code operation, uint64_t now)
+{
+    if (!trigger._armed.load(std::memory_order_relaxed))
+        return false;
+
+    bool reached = (trigger._time && now >= trigger._time);
+    if (operation == trigger._operation)
+        reached |= (trigger._count.fetch_add(1, std::memory_order_relaxed) + 1 >= trigger._calls);
+
+    // Only one thread fires the trigger
+    return reached && trigger._armed.exchange(false);
+}
+
+void Window::update(Operation::Code operation)
+{
+    uint64_t now = (_start._time || _end._time) ? Clock::now() : 0;
+
+    if (fires(_start, operation, now))
+        start();
+
+    // The window cannot end before it starts
+    if (!_start._armed.load(std::memory_order_relaxed) && fires(_end, operation, now))
+        stop();
+
+    _pending.store(_start._armed || _end._armed, std::memory_order_relaxed);
+}
+
+void Window::handler(int signal)
+{
+    if (signal == SIGUSR1)
+        start();
+    else
+        stop();
+}
+
+void Window::initialize()
+{
+    uint64_t origin = Clock::now();
+
+    bool starts = arm(_start, "SONAR_MPI_WINDOW_START_TIME", "SONAR_MPI_WINDOW_START_CALL", origin);
+    bool ends = arm(_end, "SONAR_MPI_WINDOW_END_TIME", "SONAR_MPI_WINDOW_END_CALL", origin);
+
+    Envar<std::string> signals("SONAR_MPI_WINDOW_SIGNALS", "none");
+    if (signals.get() != "none" && signals.get() != "active" && signals.get() != "inactive")
+        IOHandler::fail("Invalid value ", signals.get(), " for ", signals.getName());
+
+    // The window is inactive until the start trigger fires
+    _active = !starts && signals.get() != "inactive";
+    _pending = starts || ends;
+
+    if (signals.get() != "none") {
+        struct sigaction action = {};
+        action.sa_handler = handler;
+        action.sa_flags = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+
+        if (sigaction(SIGUSR1, &action, nullptr) || sigaction(SIGUSR2, &action, nullptr))
+            IOHandler::fail("Failed to install the handlers of ", signals.getName());
+    }
+}
+
+} // namespace sonar
@@ -0,0 +1,99 @@
+/*
+    This file is part of Sonar and is licensed under the terms contained in the COPYING file.
+
+    Copyright (C) 2023 Barcelona Supercomputing Center (BSC)
+*/
+
+#ifndef WINDOW_HPP
+#define WINDOW_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "Clock.hpp"
+#include "Operation.hpp"
+
+namespace sonar {
+
+//! Class that decides when the ovni and statistics instrumentations are
+//! active. The instrumentation window can start and end after a time offset
+//! since the initialization or at the Nth call of an operation. The window
+//! can also be toggled by the SIGUSR1 and SIGUSR2 signals at any time. The
+//! initialization and finalization operations are always instrumented
+class Window {
+private:
+    //! A condition that starts or ends the window
+    struct Trigger {
+        //! Whether the trigger has not fired yet
+        std::atomic<bool> _armed;
+        //! The absolute time of the trigger or zero
+        uint64_t _time;
+        //! The operation whose calls are counted or NumCodes
+        Operation::Code _operation;
+        //! The number of calls of the operation and the calls so far
+        uint64_t _calls;
+        std::atomic<uint64_t> _count;
+    };
+
+    //! Whether the instrumentation is active
+    static std::atomic<bool> _active;
+
+    //! Whether any trigger is armed
+    static std::atomic<bool> _pending;
+
+    //! The triggers that start and end the window
+    static Trigger _start;
+    static Trigger _end;
+
+    //! \brief Parse the options of a trigger
+    //!
+    //! \returns Whether the trigger is armed
+    static bool arm(Trigger &trigger, const char *time, const char *call, uint64_t origin);
+
+    //! \brief Check whether a trigger fires at a call of an operation
+    static bool fires(Trigger &trigger, Operation::Code operation, uint64_t now);
+
+    //! \brief Evaluate the armed triggers at a call of an operation
+    static void update(Operation::Code operation);
+
+    //! \brief Handle the signals that toggle the window
+    static void handler(int signal);
+
+public:
+    //! \brief Initialize the window from the environment
+    //!
+    //! The clock must be initialized, since the time offsets are relative to
+    //! the current time
+    static void initialize();
+
+    //! \brief Start the window
+    static void start()
+    {
+        _active.store(true, std::memory_order_relaxed);
+    }
+
+    //! \brief End the window
+    static void stop()
+    {
+        _active.store(false, std::memory_order_relaxed);
+    }
+
+    //! \brief Check whether the current call of an operation is instrumented
+    //!
+    //! The calls are counted and the time is read only while any trigger is
+    //! armed
+    template <Operation::Code Operation>
+    static bool active()
+    {
+        if (Operation <= sonar::Operation::Finalize)
+            return true;
+        if (__builtin_expect(_pending.load(std::memory_order_relaxed), 0))
+            update(Operation);
+        return _active.load(std::memory_order_relaxed);
+    }
+};
+
+} // namespace sonar
+
+#endif // WINDOW_HPP
@@ -10,15 +10,24 @@
 #include <stdlib.h>
 #include <type_traits>
 
+#include "Communicator.hpp"
+#include "Communicators.hpp"
+#include "Datatype.hpp"
 #include "Definitions.hpp"
+#include "Imbalance.hpp"
+#include "Instrument.hpp"
 #include "IOHandler.hpp"
 #include "Manager.hpp"
 #include "Operation.hpp"
+#include "Persistent.hpp"
+#include "Requests.hpp"
+#include "Topology.hpp"
 
 using int_ptr_t = MPI_Fint *;
 using recvbuf_t = void *;
 using sendbuf_t = void *;
 using request_t = int_ptr_t;
+using message_t = int_ptr_t;
 using requests_t = int_ptr_t;
 using status_t = int_ptr_t;
 using statuses_t = int_ptr_t;
@@ -28,17 +37,88 @@ using flag_t = int_ptr_t;
 using tag_t = int_ptr_t;
 using rank_t = int_ptr_t;
 using op_t = int_ptr_t;
+using info_t = int_ptr_t;
 using indices_t = int_ptr_t;
 using count_t = int_ptr_t;
+using count_c_t = MPI_Count *;
+using partition_t = int_ptr_t;
+using win_t = int_ptr_t;
+using win_handle_t = int_ptr_t;
+using group_t = int_ptr_t;
+using aint_t = MPI_Aint *;
+using baseptr_t = MPI_Aint *;
+using assert_t = int_ptr_t;
+using lock_t = int_ptr_t;
+using file_t = int_ptr_t;
+using file_handle_t = int_ptr_t;
+using offset_t = MPI_Offset *;
+using string_t = char *;
+using amode_t = int_ptr_t;
+using strlen_t = int;
 using displ_t = int_ptr_t;
 using err_t = int_ptr_t;
 
 using datas_t = data_t;
 using counts_t = count_t;
+using counts_c_t = count_c_t;
 using displs_t = displ_t;
+using displs_c_t = aint_t;
+using partitions_t = partition_t;
+
+#if MPI_VERSION >= 4
+//! The mpi_f08 bindings pass the statuses as MPI_F08_status structures,
+//! which have their own ignore constant and conversion to C statuses. Their
+//! wrappers are defined in this namespace to take these types
+namespace f08 {
+using status_t = MPI_F08_status *;
+using statuses_t = MPI_F08_status *;
+}
+
+//! Define the wrapper of an mpi_f08 binding
+#define DEFINE_F08_FUNC(n, ...)                                                \
+    namespace f08 { DEFINE_FUNC##n(__VA_ARGS__) }
+#else
+#define DEFINE_F08_FUNC(n, ...) DEFINE_FUNC##n(__VA_ARGS__)
+#endif
 
 using namespace sonar;
 
+//! The name of the profiling symbol of a Fortran function
+#define PROFILING_NAME(name) p##name
+
+//! Define the alternative manglings of a Fortran function as aliases of its
+//! wrapper. Depending on their options, the compilers append one, two or no
+//! underscores to the names or use uppercase names
+#define DEFINE_MANGLINGS(name, NAME)                                           \
+    decltype(name##_) name __attribute__((alias(#name "_")));                  \
+    decltype(name##_) name##__ __attribute__((alias(#name "_")));              \
+    decltype(name##_) NAME __attribute__((alias(#name "_")));
+
+//! Define the wrappers of a Fortran function and its mpi_f08 binding, which
+//! does not call the former. The mpi_f08 handles are structures with the
+//! Fortran handle as their only field, so both wrappers take the same
+//! arguments except the statuses. The mangling of the mpi_f08 bindings is
+//! fixed when building the MPI library, so they have no alternative manglings
+#define DEFINE_FORTRAN(n, op, cnt, name, NAME, ...)                            \
+    DEFINE_FUNC##n(Operation::Fortran, op, cnt, void, name##_, __VA_ARGS__)    \
+    DEFINE_F08_FUNC(n, Operation::Fortran, op, cnt, void, name##_f08_,         \
+                    __VA_ARGS__)                                               \
+    DEFINE_MANGLINGS(name, NAME)
+
+#define DEFINE_FORTRAN_FUNC2(...) DEFINE_FORTRAN(2, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC3(...) DEFINE_FORTRAN(3, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC4(...) DEFINE_FORTRAN(4, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC5(...) DEFINE_FORTRAN(5, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC6(...) DEFINE_FORTRAN(6, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC7(...) DEFINE_FORTRAN(7, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC8(...) DEFINE_FORTRAN(8, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC9(...) DEFINE_FORTRAN(9, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC10(...) DEFINE_FORTRAN(10, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC11(...) DEFINE_FORTRAN(11, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC12(...) DEFINE_FORTRAN(12, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC13(...) DEFINE_FORTRAN(13, __VA_ARGS__)
+#define DEFINE_FORTRAN_FUNC14(...) DEFINE_FORTRAN(14, __VA_ARGS__)
+
 extern "C" void mpi_comm_rank_(MPI_Fint *, MPI_Fint *, MPI_Fint *);
 extern "C" void mpi_comm_size_(MPI_Fint *, MPI_Fint *, MPI_Fint *);
 
@@ -58,359 +138,1954 @@ static inline std::pair<MPI_Fint, MPI_Fint> getInformation()
     return { rank, nranks };
 }
 
-#pragma GCC visibility push(default)
-
-extern "C" {
+//! The custom wrappers below are shared by the Fortran functions and their
+//! mpi_f08 bindings, which pass a null error argument when it is omitted
 
-//! Initializing and finalizing
-void mpi_init_(MPI_Fint *err)
+static void init(Symbol::Target<void(err_t)> &target, err_t err)
 {
     Instrument::preinitialize();
+    Symbol::loadAll(Instrument::rebind());
 
     Manager::process<Operation::Fortran, Operation::Init,
-                     Operation::Regular, void>("mpi_init_", err);
+                     Operation::Regular, void>(target, err);
 
     auto [rank, nranks] = getInformation();
     Instrument::initialize(rank, nranks);
 }
 
-void mpi_init_thread_(MPI_Fint required, MPI_Fint *provided, MPI_Fint *err)
+static void initThread(Symbol::Target<void(int_ptr_t, int_ptr_t, err_t)> &target,
+                       int_ptr_t required, int_ptr_t provided, err_t err)
 {
     Instrument::preinitialize();
+    Symbol::loadAll(Instrument::rebind());
 
     Manager::process<Operation::Fortran, Operation::InitThread,
-                     Operation::Regular, void>("mpi_init_thread_", required,
-                                               provided, err);
+                     Operation::Regular, void>(target, required, provided, err);
 
     auto [rank, nranks] = getInformation();
     Instrument::initialize(rank, nranks);
 }
 
-void mpi_finalize_(MPI_Fint *err)
+static void finalize(Symbol::Target<void(err_t)> &target, err_t err)
 {
+    Instrument::prefinalize();
+
     Manager::process<Operation::Fortran, Operation::Finalize,
-                     Operation::Regular, void>("mpi_finalize_", err);
+                     Operation::Regular, void>(target, err);
 
     Instrument::finalize();
 }
 
+static void typeFree(Symbol::Target<void(data_t, err_t)> &target,
+                     data_t type, err_t err)
+{
+    (*target.get())(type, err);
+
+    Datatype::invalidate();
+}
+
+static void requestFree(Symbol::Target<void(request_t, err_t)> &target,
+                        request_t request, err_t err)
+{
+    if (Requests::enabled())
+        Requests::forget(MPI_Request_f2c(*request));
+    if (Persistent::enabled())
+        Persistent::forget(MPI_Request_f2c(*request));
+
+    (*target.get())(request, err);
+}
+
+static void commFree(Symbol::Target<void(comm_t, err_t)> &target,
+                     comm_t comm, err_t err)
+{
+    int32_t id = *comm;
+
+    Manager::process<Operation::Fortran, Operation::CommFree,
+                     Operation::Regular, void>(target, comm, err);
+
+    Communicator::invalidate();
+    if (Imbalance::enabled())
+        Imbalance::release(id);
+    if (Topology::enabled())
+        Topology::release(id);
+    if (Communicators::enabled())
+        Communicators::release(id);
+}
+
+static void pcontrol(Symbol::Target<void(int_ptr_t)> &target, int_ptr_t level)
+{
+    if (Instrument::enabled())
+        Instrument::pcontrol(*level);
+
+    (*target.get())(level);
+}
+
+#pragma GCC visibility push(default)
+
+extern "C" {
+
+//! Initializing and finalizing. The required thread level is passed by
+//! reference like any other Fortran argument. The wrappers are pinned, so the
+//! finalization is intercepted even if the other calls are rebound
+DECLARE_PINNED_TARGET(void, mpi_init_, err_t)
+DECLARE_PINNED_TARGET(void, mpi_init_f08_, err_t)
+void mpi_init_(err_t err)
+{
+    init(mpi_init__target, err);
+}
+void mpi_init_f08_(err_t err)
+{
+    init(mpi_init_f08__target, err);
+}
+DEFINE_MANGLINGS(mpi_init, MPI_INIT)
+
+DECLARE_PINNED_TARGET(void, mpi_init_thread_, int_ptr_t, int_ptr_t, err_t)
+DECLARE_PINNED_TARGET(void, mpi_init_thread_f08_, int_ptr_t, int_ptr_t, err_t)
+void mpi_init_thread_(int_ptr_t required, int_ptr_t provided, err_t err)
+{
+    initThread(mpi_init_thread__target, required, provided, err);
+}
+void mpi_init_thread_f08_(int_ptr_t required, int_ptr_t provided, err_t err)
+{
+    initThread(mpi_init_thread_f08__target, required, provided, err);
+}
+DEFINE_MANGLINGS(mpi_init_thread, MPI_INIT_THREAD)
+
+DECLARE_PINNED_TARGET(void, mpi_finalize_, err_t)
+DECLARE_PINNED_TARGET(void, mpi_finalize_f08_, err_t)
+void mpi_finalize_(err_t err)
+{
+    finalize(mpi_finalize__target, err);
+}
+void mpi_finalize_f08_(err_t err)
+{
+    finalize(mpi_finalize_f08__target, err);
+}
+DEFINE_MANGLINGS(mpi_finalize, MPI_FINALIZE)
+
+//! Freeing datatypes invalidates the cached datatype sizes
+DECLARE_TARGET(void, mpi_type_free_, data_t, err_t)
+DECLARE_TARGET(void, mpi_type_free_f08_, data_t, err_t)
+void mpi_type_free_(data_t type, err_t err)
+{
+    typeFree(mpi_type_free__target, type, err);
+}
+void mpi_type_free_f08_(data_t type, err_t err)
+{
+    typeFree(mpi_type_free_f08__target, type, err);
+}
+DEFINE_MANGLINGS(mpi_type_free, MPI_TYPE_FREE)
+
+//! Freed requests are not tracked anymore
+DECLARE_TARGET(void, mpi_request_free_, request_t, err_t)
+DECLARE_TARGET(void, mpi_request_free_f08_, request_t, err_t)
+void mpi_request_free_(request_t request, err_t err)
+{
+    requestFree(mpi_request_free__target, request, err);
+}
+void mpi_request_free_f08_(request_t request, err_t err)
+{
+    requestFree(mpi_request_free_f08__target, request, err);
+}
+DEFINE_MANGLINGS(mpi_request_free, MPI_REQUEST_FREE)
+
+//! Freeing communicators invalidates the cached rank translations, the
+//! collective state, the neighbors and the job-wide identifier of the
+//! communicator
+DECLARE_TARGET(void, mpi_comm_free_, comm_t, err_t)
+DECLARE_TARGET(void, mpi_comm_free_f08_, comm_t, err_t)
+void mpi_comm_free_(comm_t comm, err_t err)
+{
+    commFree(mpi_comm_free__target, comm, err);
+}
+void mpi_comm_free_f08_(comm_t comm, err_t err)
+{
+    commFree(mpi_comm_free_f08__target, comm, err);
+}
+DEFINE_MANGLINGS(mpi_comm_free, MPI_COMM_FREE)
+
+//! Profiling control calls start and stop the instrumentation
+DECLARE_TARGET(void, mpi_pcontrol_, int_ptr_t)
+DECLARE_TARGET(void, mpi_pcontrol_f08_, int_ptr_t)
+void mpi_pcontrol_(int_ptr_t level)
+{
+    pcontrol(mpi_pcontrol__target, level);
+}
+void mpi_pcontrol_f08_(int_ptr_t level)
+{
+    pcontrol(mpi_pcontrol_f08__target, level);
+}
+DEFINE_MANGLINGS(mpi_pcontrol, MPI_PCONTROL)
+
 //! Waiting requests
-DEFINE_FUNC3(
-        Operation::Fortran, Operation::Wait, Operation::Regular,
-        void, mpi_wait_,
+DEFINE_FORTRAN_FUNC3(
+        Operation::Wait, Operation::Regular,
+        mpi_wait, MPI_WAIT,
         request_t, status_t, err_t
 );
-DEFINE_FUNC4(
-        Operation::Fortran, Operation::Waitall, Operation::Regular,
-        void, mpi_waitall_,
+DEFINE_FORTRAN_FUNC4(
+        Operation::Waitall, Operation::Regular,
+        mpi_waitall, MPI_WAITALL,
         count_t, requests_t, statuses_t, err_t
 );
-DEFINE_FUNC5(
-        Operation::Fortran, Operation::Waitany, Operation::Regular,
-        void, mpi_waitany_,
+DEFINE_FORTRAN_FUNC5(
+        Operation::Waitany, Operation::Regular,
+        mpi_waitany, MPI_WAITANY,
         count_t, requests_t, indices_t, statuses_t, err_t
 );
-DEFINE_FUNC6(
-        Operation::Fortran, Operation::Waitsome, Operation::Regular,
-        void, mpi_waitsome_,
+DEFINE_FORTRAN_FUNC6(
+        Operation::Waitsome, Operation::Regular,
+        mpi_waitsome, MPI_WAITSOME,
         count_t, requests_t, flag_t, indices_t, statuses_t, err_t
 );
 
 //! Testing requests
-DEFINE_FUNC4(
-        Operation::Fortran, Operation::Test, Operation::Regular,
-        void, mpi_test_,
+DEFINE_FORTRAN_FUNC4(
+        Operation::Test, Operation::Regular,
+        mpi_test, MPI_TEST,
         request_t, flag_t, status_t, err_t
 );
-DEFINE_FUNC5(
-        Operation::Fortran, Operation::Testall, Operation::Regular,
-        void, mpi_testall_,
+DEFINE_FORTRAN_FUNC5(
+        Operation::Testall, Operation::Regular,
+        mpi_testall, MPI_TESTALL,
         count_t, requests_t, flag_t, statuses_t, err_t
 );
-DEFINE_FUNC6(
-        Operation::Fortran, Operation::Testany, Operation::Regular,
-        void, mpi_testany_,
+DEFINE_FORTRAN_FUNC6(
+        Operation::Testany, Operation::Regular,
+        mpi_testany, MPI_TESTANY,
         count_t, requests_t, indices_t, flag_t, statuses_t, err_t
 );
-DEFINE_FUNC6(
-        Operation::Fortran, Operation::Testsome, Operation::Regular,
-        void, mpi_testsome_,
+DEFINE_FORTRAN_FUNC6(
+        Operation::Testsome, Operation::Regular,
+        mpi_testsome, MPI_TESTSOME,
         count_t, requests_t, flag_t, indices_t, statuses_t, err_t
 );
 
+//! Probing messages
+DEFINE_FORTRAN_FUNC7(
+        Operation::Improbe, Operation::Regular,
+        mpi_improbe, MPI_IMPROBE,
+        rank_t, tag_t, comm_t, flag_t, message_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::Iprobe, Operation::Regular,
+        mpi_iprobe, MPI_IPROBE,
+        rank_t, tag_t, comm_t, flag_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::Mprobe, Operation::Regular,
+        mpi_mprobe, MPI_MPROBE,
+        rank_t, tag_t, comm_t, message_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC5(
+        Operation::Probe, Operation::Regular,
+        mpi_probe, MPI_PROBE,
+        rank_t, tag_t, comm_t, status_t, err_t
+);
+
 //! Blocking primitives
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Bsend, Operation::Regular,
-        void, mpi_bsend_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Bsend, Operation::Regular,
+        mpi_bsend, MPI_BSEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Recv, Operation::Regular,
-        void, mpi_recv_,
+DEFINE_FORTRAN_FUNC6(
+        Operation::Mrecv, Operation::Regular,
+        mpi_mrecv, MPI_MRECV,
+        recvbuf_t, count_t, data_t, message_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::Recv, Operation::Regular,
+        mpi_recv, MPI_RECV,
         recvbuf_t, count_t, data_t, rank_t, tag_t, comm_t, status_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Rsend, Operation::Regular,
-        void, mpi_rsend_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Rsend, Operation::Regular,
+        mpi_rsend, MPI_RSEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Send, Operation::Regular,
-        void, mpi_send_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Send, Operation::Regular,
+        mpi_send, MPI_SEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, err_t
 );
-DEFINE_FUNC13(
-        Operation::Fortran, Operation::Sendrecv, Operation::Regular,
-        void, mpi_sendrecv_,
+DEFINE_FORTRAN_FUNC13(
+        Operation::Sendrecv, Operation::Regular,
+        mpi_sendrecv, MPI_SENDRECV,
         sendbuf_t, count_t, data_t, rank_t, tag_t, recvbuf_t, count_t, data_t,
         rank_t, tag_t, comm_t, status_t, err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::SendrecvReplace, Operation::Regular,
-        void, mpi_sendrecv_replace_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::SendrecvReplace, Operation::Regular,
+        mpi_sendrecv_replace, MPI_SENDRECV_REPLACE,
         recvbuf_t, count_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
         status_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Ssend, Operation::Regular,
-        void, mpi_ssend_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Ssend, Operation::Regular,
+        mpi_ssend, MPI_SSEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, err_t
 );
 
 //! Blocking collectives
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Allgather, Operation::Regular,
-        void, mpi_allgather_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Allgather, Operation::Regular,
+        mpi_allgather, MPI_ALLGATHER,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, err_t
 );
-DEFINE_FUNC9(
-        Operation::Fortran, Operation::Allgatherv, Operation::Regular,
-        void, mpi_allgatherv_,
+DEFINE_FORTRAN_FUNC9(
+        Operation::Allgatherv, Operation::Regular,
+        mpi_allgatherv, MPI_ALLGATHERV,
         sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
         comm_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Allreduce, Operation::Regular,
-        void, mpi_allreduce_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Allreduce, Operation::Regular,
+        mpi_allreduce, MPI_ALLREDUCE,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Alltoall, Operation::Regular,
-        void, mpi_alltoall_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Alltoall, Operation::Regular,
+        mpi_alltoall, MPI_ALLTOALL,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::Alltoallv, Operation::Regular,
-        void, mpi_alltoallv_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::Alltoallv, Operation::Regular,
+        mpi_alltoallv, MPI_ALLTOALLV,
         sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
         data_t, comm_t, err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::Alltoallw, Operation::Regular,
-        void, mpi_alltoallw_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::Alltoallw, Operation::Regular,
+        mpi_alltoallw, MPI_ALLTOALLW,
         sendbuf_t, counts_t, displs_t, datas_t, recvbuf_t, counts_t, displs_t,
         datas_t, comm_t, err_t
 );
-DEFINE_FUNC2(
-        Operation::Fortran, Operation::Barrier, Operation::Regular,
-        void, mpi_barrier_,
+DEFINE_FORTRAN_FUNC2(
+        Operation::Barrier, Operation::Regular,
+        mpi_barrier, MPI_BARRIER,
         comm_t, err_t
 );
-DEFINE_FUNC6(
-        Operation::Fortran, Operation::Bcast, Operation::Regular,
-        void, mpi_bcast_,
+DEFINE_FORTRAN_FUNC6(
+        Operation::Bcast, Operation::Regular,
+        mpi_bcast, MPI_BCAST,
         recvbuf_t, count_t, data_t, rank_t, comm_t, err_t
 );
-DEFINE_FUNC9(
-        Operation::Fortran, Operation::Gather, Operation::Regular,
-        void, mpi_gather_,
+DEFINE_FORTRAN_FUNC9(
+        Operation::Gather, Operation::Regular,
+        mpi_gather, MPI_GATHER,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
         err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::Gatherv, Operation::Regular,
-        void, mpi_gatherv_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::Gatherv, Operation::Regular,
+        mpi_gatherv, MPI_GATHERV,
         sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
         rank_t, comm_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Reduce, Operation::Regular,
-        void, mpi_reduce_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Reduce, Operation::Regular,
+        mpi_reduce, MPI_REDUCE,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, rank_t, comm_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::ReduceScatter, Operation::Regular,
-        void, mpi_reduce_scatter_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::ReduceScatter, Operation::Regular,
+        mpi_reduce_scatter, MPI_REDUCE_SCATTER,
         sendbuf_t, recvbuf_t, counts_t, data_t, op_t, comm_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::ReduceScatterBlock, Operation::Regular,
-        void, mpi_reduce_scatter_block_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::ReduceScatterBlock, Operation::Regular,
+        mpi_reduce_scatter_block, MPI_REDUCE_SCATTER_BLOCK,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, err_t
 );
-DEFINE_FUNC9(
-        Operation::Fortran, Operation::Scatter, Operation::Regular,
-        void, mpi_scatter_,
+DEFINE_FORTRAN_FUNC9(
+        Operation::Scatter, Operation::Regular,
+        mpi_scatter, MPI_SCATTER,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
         err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::Scatterv, Operation::Regular,
-        void, mpi_scatterv_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::Scatterv, Operation::Regular,
+        mpi_scatterv, MPI_SCATTERV,
         sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, count_t, data_t,
         rank_t, comm_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Scan, Operation::Regular,
-        void, mpi_scan_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Scan, Operation::Regular,
+        mpi_scan, MPI_SCAN,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Exscan, Operation::Regular,
-        void, mpi_exscan_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Exscan, Operation::Regular,
+        mpi_exscan, MPI_EXSCAN,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, err_t
 );
 
 //! Non-blocking primitives
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Ibsend, Operation::Regular,
-        void, mpi_ibsend_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Ibsend, Operation::Regular,
+        mpi_ibsend, MPI_IBSEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Irecv, Operation::Regular,
-        void, mpi_irecv_,
+DEFINE_FORTRAN_FUNC6(
+        Operation::Imrecv, Operation::Regular,
+        mpi_imrecv, MPI_IMRECV,
+        recvbuf_t, count_t, data_t, message_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::Irecv, Operation::Regular,
+        mpi_irecv, MPI_IRECV,
         recvbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Irsend, Operation::Regular,
-        void, mpi_irsend_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Irsend, Operation::Regular,
+        mpi_irsend, MPI_IRSEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Isend, Operation::Regular,
-        void, mpi_isend_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Isend, Operation::Regular,
+        mpi_isend, MPI_ISEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Issend, Operation::Regular,
-        void, mpi_issend_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Issend, Operation::Regular,
+        mpi_issend, MPI_ISSEND,
         sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
 );
 
 //! Non-blocking collectives
-DEFINE_FUNC9(
-        Operation::Fortran, Operation::Iallgather, Operation::Regular,
-        void, mpi_iallgather_,
+DEFINE_FORTRAN_FUNC9(
+        Operation::Iallgather, Operation::Regular,
+        mpi_iallgather, MPI_IALLGATHER,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t,
         request_t, err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::Iallgatherv, Operation::Regular,
-        void, mpi_iallgatherv_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::Iallgatherv, Operation::Regular,
+        mpi_iallgatherv, MPI_IALLGATHERV,
         sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
         comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Iallreduce, Operation::Regular,
-        void, mpi_iallreduce_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Iallreduce, Operation::Regular,
+        mpi_iallreduce, MPI_IALLREDUCE,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC9(
-        Operation::Fortran, Operation::Ialltoall, Operation::Regular,
-        void, mpi_ialltoall_,
+DEFINE_FORTRAN_FUNC9(
+        Operation::Ialltoall, Operation::Regular,
+        mpi_ialltoall, MPI_IALLTOALL,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t,
         request_t, err_t
 );
-DEFINE_FUNC11(
-        Operation::Fortran, Operation::Ialltoallv, Operation::Regular,
-        void, mpi_ialltoallv_,
+DEFINE_FORTRAN_FUNC11(
+        Operation::Ialltoallv, Operation::Regular,
+        mpi_ialltoallv, MPI_IALLTOALLV,
         sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
         data_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC11(
-        Operation::Fortran, Operation::Ialltoallw, Operation::Regular,
-        void, mpi_ialltoallw_,
+DEFINE_FORTRAN_FUNC11(
+        Operation::Ialltoallw, Operation::Regular,
+        mpi_ialltoallw, MPI_IALLTOALLW,
         sendbuf_t, counts_t, displs_t, datas_t, recvbuf_t, counts_t, displs_t,
         datas_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC3(
-        Operation::Fortran, Operation::Ibarrier, Operation::Regular,
-        void, mpi_ibarrier_,
+DEFINE_FORTRAN_FUNC3(
+        Operation::Ibarrier, Operation::Regular,
+        mpi_ibarrier, MPI_IBARRIER,
         comm_t, request_t, err_t
 );
-DEFINE_FUNC7(
-        Operation::Fortran, Operation::Ibcast, Operation::Regular,
-        void, mpi_ibcast_,
+DEFINE_FORTRAN_FUNC7(
+        Operation::Ibcast, Operation::Regular,
+        mpi_ibcast, MPI_IBCAST,
         recvbuf_t, count_t, data_t, rank_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::Igather, Operation::Regular,
-        void, mpi_igather_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::Igather, Operation::Regular,
+        mpi_igather, MPI_IGATHER,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
         request_t, err_t
 );
-DEFINE_FUNC11(
-        Operation::Fortran, Operation::Igatherv, Operation::Regular,
-        void, mpi_igatherv_,
+DEFINE_FORTRAN_FUNC11(
+        Operation::Igatherv, Operation::Regular,
+        mpi_igatherv, MPI_IGATHERV,
         sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
         rank_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC9(
-        Operation::Fortran, Operation::Ireduce, Operation::Regular,
-        void, mpi_ireduce_,
+DEFINE_FORTRAN_FUNC9(
+        Operation::Ireduce, Operation::Regular,
+        mpi_ireduce, MPI_IREDUCE,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, rank_t, comm_t, request_t,
         err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::IreduceScatter, Operation::Regular,
-        void, mpi_ireduce_scatter_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::IreduceScatter, Operation::Regular,
+        mpi_ireduce_scatter, MPI_IREDUCE_SCATTER,
         sendbuf_t, recvbuf_t, counts_t, data_t, op_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::IreduceScatterBlock, Operation::Regular,
-        void, mpi_ireduce_scatter_block_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::IreduceScatterBlock, Operation::Regular,
+        mpi_ireduce_scatter_block, MPI_IREDUCE_SCATTER_BLOCK,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::Iscatter, Operation::Regular,
-        void, mpi_iscatter_,
+DEFINE_FORTRAN_FUNC10(
+        Operation::Iscatter, Operation::Regular,
+        mpi_iscatter, MPI_ISCATTER,
         sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
         request_t, err_t
 );
-DEFINE_FUNC11(
-        Operation::Fortran, Operation::Iscatterv, Operation::Regular,
-        void, mpi_iscatterv_,
+DEFINE_FORTRAN_FUNC11(
+        Operation::Iscatterv, Operation::Regular,
+        mpi_iscatterv, MPI_ISCATTERV,
         sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, count_t, data_t,
         rank_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Iscan, Operation::Regular,
-        void, mpi_iscan_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Iscan, Operation::Regular,
+        mpi_iscan, MPI_ISCAN,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, request_t, err_t
 );
-DEFINE_FUNC8(
-        Operation::Fortran, Operation::Iexscan, Operation::Regular,
-        void, mpi_iexscan_,
+DEFINE_FORTRAN_FUNC8(
+        Operation::Iexscan, Operation::Regular,
+        mpi_iexscan, MPI_IEXSCAN,
         sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, request_t, err_t
 );
 
-//! The version MPI 4.0 introduces the non-blocking sendrecv primitives
-#if MPI_VERSION >= 4
+//! Persistent primitives
+DEFINE_FORTRAN_FUNC8(
+        Operation::BsendInit, Operation::Regular,
+        mpi_bsend_init, MPI_BSEND_INIT,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::RecvInit, Operation::Regular,
+        mpi_recv_init, MPI_RECV_INIT,
+        recvbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::RsendInit, Operation::Regular,
+        mpi_rsend_init, MPI_RSEND_INIT,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::SendInit, Operation::Regular,
+        mpi_send_init, MPI_SEND_INIT,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::SsendInit, Operation::Regular,
+        mpi_ssend_init, MPI_SSEND_INIT,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
 
-//! Non-blocking sendrecv primitives
-DEFINE_FUNC13(
-        Operation::Fortran, Operation::Isendrecv, Operation::Regular,
-        void, mpi_isendrecv_,
-        sendbuf_t, count_t, data_t, rank_t, tag_t, recvbuf_t, count_t, data_t,
-        rank_t, tag_t, comm_t, request_t, err_t
+//! Starting persistent requests
+DEFINE_FORTRAN_FUNC2(
+        Operation::Start, Operation::Regular,
+        mpi_start, MPI_START,
+        request_t, err_t
 );
-DEFINE_FUNC10(
-        Operation::Fortran, Operation::IsendrecvReplace, Operation::Regular,
-        void, mpi_isendrecv_replace_,
-        recvbuf_t, count_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+DEFINE_FORTRAN_FUNC3(
+        Operation::Startall, Operation::Regular,
+        mpi_startall, MPI_STARTALL,
+        count_t, requests_t, err_t
+);
+
+//! Creating and freeing RMA windows
+DEFINE_FORTRAN_FUNC7(
+        Operation::WinAllocate, Operation::Regular,
+        mpi_win_allocate, MPI_WIN_ALLOCATE,
+        aint_t, count_t, info_t, comm_t, baseptr_t, win_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::WinAllocateShared, Operation::Regular,
+        mpi_win_allocate_shared, MPI_WIN_ALLOCATE_SHARED,
+        aint_t, count_t, info_t, comm_t, baseptr_t, win_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::WinCreate, Operation::Regular,
+        mpi_win_create, MPI_WIN_CREATE,
+        recvbuf_t, aint_t, count_t, info_t, comm_t, win_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::WinCreateDynamic, Operation::Regular,
+        mpi_win_create_dynamic, MPI_WIN_CREATE_DYNAMIC,
+        info_t, comm_t, win_t, err_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::WinFree, Operation::Regular,
+        mpi_win_free, MPI_WIN_FREE,
+        win_t, err_t
+);
+
+//! RMA communication
+DEFINE_FORTRAN_FUNC10(
+        Operation::Accumulate, Operation::Regular,
+        mpi_accumulate, MPI_ACCUMULATE,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t, op_t,
+        win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::CompareAndSwap, Operation::Regular,
+        mpi_compare_and_swap, MPI_COMPARE_AND_SWAP,
+        sendbuf_t, sendbuf_t, recvbuf_t, data_t, rank_t, aint_t, win_handle_t,
+        err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::FetchAndOp, Operation::Regular,
+        mpi_fetch_and_op, MPI_FETCH_AND_OP,
+        sendbuf_t, recvbuf_t, data_t, rank_t, aint_t, op_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::Get, Operation::Regular,
+        mpi_get, MPI_GET,
+        recvbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC13(
+        Operation::GetAccumulate, Operation::Regular,
+        mpi_get_accumulate, MPI_GET_ACCUMULATE,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, aint_t,
+        count_t, data_t, op_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::Put, Operation::Regular,
+        mpi_put, MPI_PUT,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t, err_t
+);
+
+//! Request-based RMA communication
+DEFINE_FORTRAN_FUNC11(
+        Operation::Raccumulate, Operation::Regular,
+        mpi_raccumulate, MPI_RACCUMULATE,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t, op_t,
+        win_handle_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::Rget, Operation::Regular,
+        mpi_rget, MPI_RGET,
+        recvbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC14(
+        Operation::RgetAccumulate, Operation::Regular,
+        mpi_rget_accumulate, MPI_RGET_ACCUMULATE,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, aint_t,
+        count_t, data_t, op_t, win_handle_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::Rput, Operation::Regular,
+        mpi_rput, MPI_RPUT,
+        sendbuf_t, count_t, data_t, rank_t, aint_t, count_t, data_t,
+        win_handle_t, request_t, err_t
+);
+
+//! RMA active target synchronization
+DEFINE_FORTRAN_FUNC3(
+        Operation::WinFence, Operation::Regular,
+        mpi_win_fence, MPI_WIN_FENCE,
+        assert_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::WinPost, Operation::Regular,
+        mpi_win_post, MPI_WIN_POST,
+        group_t, assert_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::WinStart, Operation::Regular,
+        mpi_win_start, MPI_WIN_START,
+        group_t, assert_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::WinComplete, Operation::Regular,
+        mpi_win_complete, MPI_WIN_COMPLETE,
+        win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::WinWait, Operation::Regular,
+        mpi_win_wait, MPI_WIN_WAIT,
+        win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC3(
+        Operation::WinTest, Operation::Regular,
+        mpi_win_test, MPI_WIN_TEST,
+        win_handle_t, flag_t, err_t
+);
+
+//! RMA passive target synchronization
+DEFINE_FORTRAN_FUNC5(
+        Operation::WinLock, Operation::Regular,
+        mpi_win_lock, MPI_WIN_LOCK,
+        lock_t, rank_t, assert_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC3(
+        Operation::WinUnlock, Operation::Regular,
+        mpi_win_unlock, MPI_WIN_UNLOCK,
+        rank_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC3(
+        Operation::WinLockAll, Operation::Regular,
+        mpi_win_lock_all, MPI_WIN_LOCK_ALL,
+        assert_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::WinUnlockAll, Operation::Regular,
+        mpi_win_unlock_all, MPI_WIN_UNLOCK_ALL,
+        win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC3(
+        Operation::WinFlush, Operation::Regular,
+        mpi_win_flush, MPI_WIN_FLUSH,
+        rank_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::WinFlushAll, Operation::Regular,
+        mpi_win_flush_all, MPI_WIN_FLUSH_ALL,
+        win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC3(
+        Operation::WinFlushLocal, Operation::Regular,
+        mpi_win_flush_local, MPI_WIN_FLUSH_LOCAL,
+        rank_t, win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::WinFlushLocalAll, Operation::Regular,
+        mpi_win_flush_local_all, MPI_WIN_FLUSH_LOCAL_ALL,
+        win_handle_t, err_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::WinSync, Operation::Regular,
+        mpi_win_sync, MPI_WIN_SYNC,
+        win_handle_t, err_t
+);
+
+//! Opening and managing files. The length of the string arguments is passed
+//! as a hidden argument after the error argument
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileOpen, Operation::Regular,
+        mpi_file_open, MPI_FILE_OPEN,
+        comm_t, string_t, amode_t, info_t, file_t, err_t, strlen_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::FileClose, Operation::Regular,
+        mpi_file_close, MPI_FILE_CLOSE,
+        file_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::FileSetView, Operation::Regular,
+        mpi_file_set_view, MPI_FILE_SET_VIEW,
+        file_handle_t, offset_t, data_t, data_t, string_t, info_t, err_t,
+        strlen_t
+);
+DEFINE_FORTRAN_FUNC2(
+        Operation::FileSync, Operation::Regular,
+        mpi_file_sync, MPI_FILE_SYNC,
+        file_handle_t, err_t
+);
+
+//! Independent file accesses
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileRead, Operation::Regular,
+        mpi_file_read, MPI_FILE_READ,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileReadAt, Operation::Regular,
+        mpi_file_read_at, MPI_FILE_READ_AT,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileReadShared, Operation::Regular,
+        mpi_file_read_shared, MPI_FILE_READ_SHARED,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileWrite, Operation::Regular,
+        mpi_file_write, MPI_FILE_WRITE,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileWriteAt, Operation::Regular,
+        mpi_file_write_at, MPI_FILE_WRITE_AT,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileWriteShared, Operation::Regular,
+        mpi_file_write_shared, MPI_FILE_WRITE_SHARED,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t, err_t
+);
+
+//! Collective file accesses
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileReadAll, Operation::Regular,
+        mpi_file_read_all, MPI_FILE_READ_ALL,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileReadAtAll, Operation::Regular,
+        mpi_file_read_at_all, MPI_FILE_READ_AT_ALL,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileReadOrdered, Operation::Regular,
+        mpi_file_read_ordered, MPI_FILE_READ_ORDERED,
+        file_handle_t, recvbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileWriteAll, Operation::Regular,
+        mpi_file_write_all, MPI_FILE_WRITE_ALL,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileWriteAtAll, Operation::Regular,
+        mpi_file_write_at_all, MPI_FILE_WRITE_AT_ALL,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileWriteOrdered, Operation::Regular,
+        mpi_file_write_ordered, MPI_FILE_WRITE_ORDERED,
+        file_handle_t, sendbuf_t, count_t, data_t, status_t, err_t
+);
+
+//! Non-blocking file accesses
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileIread, Operation::Regular,
+        mpi_file_iread, MPI_FILE_IREAD,
+        file_handle_t, recvbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileIreadAt, Operation::Regular,
+        mpi_file_iread_at, MPI_FILE_IREAD_AT,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileIreadShared, Operation::Regular,
+        mpi_file_iread_shared, MPI_FILE_IREAD_SHARED,
+        file_handle_t, recvbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileIwrite, Operation::Regular,
+        mpi_file_iwrite, MPI_FILE_IWRITE,
+        file_handle_t, sendbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileIwriteAt, Operation::Regular,
+        mpi_file_iwrite_at, MPI_FILE_IWRITE_AT,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileIwriteShared, Operation::Regular,
+        mpi_file_iwrite_shared, MPI_FILE_IWRITE_SHARED,
+        file_handle_t, sendbuf_t, count_t, data_t, request_t, err_t
+);
+
+//! The version MPI 3.1 introduces the non-blocking collective file accesses
+#if MPI_VERSION > 3 || (MPI_VERSION == 3 && MPI_SUBVERSION >= 1)
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileIreadAll, Operation::Regular,
+        mpi_file_iread_all, MPI_FILE_IREAD_ALL,
+        file_handle_t, recvbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileIreadAtAll, Operation::Regular,
+        mpi_file_iread_at_all, MPI_FILE_IREAD_AT_ALL,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileIwriteAll, Operation::Regular,
+        mpi_file_iwrite_all, MPI_FILE_IWRITE_ALL,
+        file_handle_t, sendbuf_t, count_t, data_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::FileIwriteAtAll, Operation::Regular,
+        mpi_file_iwrite_at_all, MPI_FILE_IWRITE_AT_ALL,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, request_t, err_t
+);
+#endif
+
+//! Split collective file accesses
+DEFINE_FORTRAN_FUNC5(
+        Operation::FileReadAllBegin, Operation::Regular,
+        mpi_file_read_all_begin, MPI_FILE_READ_ALL_BEGIN,
+        file_handle_t, recvbuf_t, count_t, data_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::FileReadAllEnd, Operation::Regular,
+        mpi_file_read_all_end, MPI_FILE_READ_ALL_END,
+        file_handle_t, recvbuf_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileReadAtAllBegin, Operation::Regular,
+        mpi_file_read_at_all_begin, MPI_FILE_READ_AT_ALL_BEGIN,
+        file_handle_t, offset_t, recvbuf_t, count_t, data_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::FileReadAtAllEnd, Operation::Regular,
+        mpi_file_read_at_all_end, MPI_FILE_READ_AT_ALL_END,
+        file_handle_t, recvbuf_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC5(
+        Operation::FileReadOrderedBegin, Operation::Regular,
+        mpi_file_read_ordered_begin, MPI_FILE_READ_ORDERED_BEGIN,
+        file_handle_t, recvbuf_t, count_t, data_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::FileReadOrderedEnd, Operation::Regular,
+        mpi_file_read_ordered_end, MPI_FILE_READ_ORDERED_END,
+        file_handle_t, recvbuf_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC5(
+        Operation::FileWriteAllBegin, Operation::Regular,
+        mpi_file_write_all_begin, MPI_FILE_WRITE_ALL_BEGIN,
+        file_handle_t, sendbuf_t, count_t, data_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::FileWriteAllEnd, Operation::Regular,
+        mpi_file_write_all_end, MPI_FILE_WRITE_ALL_END,
+        file_handle_t, sendbuf_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::FileWriteAtAllBegin, Operation::Regular,
+        mpi_file_write_at_all_begin, MPI_FILE_WRITE_AT_ALL_BEGIN,
+        file_handle_t, offset_t, sendbuf_t, count_t, data_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::FileWriteAtAllEnd, Operation::Regular,
+        mpi_file_write_at_all_end, MPI_FILE_WRITE_AT_ALL_END,
+        file_handle_t, sendbuf_t, status_t, err_t
+);
+DEFINE_FORTRAN_FUNC5(
+        Operation::FileWriteOrderedBegin, Operation::Regular,
+        mpi_file_write_ordered_begin, MPI_FILE_WRITE_ORDERED_BEGIN,
+        file_handle_t, sendbuf_t, count_t, data_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::FileWriteOrderedEnd, Operation::Regular,
+        mpi_file_write_ordered_end, MPI_FILE_WRITE_ORDERED_END,
+        file_handle_t, sendbuf_t, status_t, err_t
+);
+
+//! Neighborhood collectives
+DEFINE_FORTRAN_FUNC8(
+        Operation::NeighborAllgather, Operation::Regular,
+        mpi_neighbor_allgather, MPI_NEIGHBOR_ALLGATHER,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::NeighborAllgatherv, Operation::Regular,
+        mpi_neighbor_allgatherv, MPI_NEIGHBOR_ALLGATHERV,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::NeighborAlltoall, Operation::Regular,
+        mpi_neighbor_alltoall, MPI_NEIGHBOR_ALLTOALL,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::NeighborAlltoallv, Operation::Regular,
+        mpi_neighbor_alltoallv, MPI_NEIGHBOR_ALLTOALLV,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::NeighborAlltoallw, Operation::Regular,
+        mpi_neighbor_alltoallw, MPI_NEIGHBOR_ALLTOALLW,
+        sendbuf_t, counts_t, aint_t, datas_t, recvbuf_t, counts_t, aint_t,
+        datas_t, comm_t, err_t
+);
+
+//! Non-blocking neighborhood collectives
+DEFINE_FORTRAN_FUNC9(
+        Operation::IneighborAllgather, Operation::Regular,
+        mpi_ineighbor_allgather, MPI_INEIGHBOR_ALLGATHER,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t,
+        request_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::IneighborAllgatherv, Operation::Regular,
+        mpi_ineighbor_allgatherv, MPI_INEIGHBOR_ALLGATHERV,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::IneighborAlltoall, Operation::Regular,
+        mpi_ineighbor_alltoall, MPI_INEIGHBOR_ALLTOALL,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t,
         request_t, err_t
 );
+DEFINE_FORTRAN_FUNC11(
+        Operation::IneighborAlltoallv, Operation::Regular,
+        mpi_ineighbor_alltoallv, MPI_INEIGHBOR_ALLTOALLV,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC11(
+        Operation::IneighborAlltoallw, Operation::Regular,
+        mpi_ineighbor_alltoallw, MPI_INEIGHBOR_ALLTOALLW,
+        sendbuf_t, counts_t, aint_t, datas_t, recvbuf_t, counts_t, aint_t,
+        datas_t, comm_t, request_t, err_t
+);
+
+//! Creating topology communicators
+DEFINE_FORTRAN_FUNC7(
+        Operation::CartCreate, Operation::Regular,
+        mpi_cart_create, MPI_CART_CREATE,
+        comm_t, int_ptr_t, int_ptr_t, int_ptr_t, int_ptr_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::GraphCreate, Operation::Regular,
+        mpi_graph_create, MPI_GRAPH_CREATE,
+        comm_t, int_ptr_t, int_ptr_t, int_ptr_t, int_ptr_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::DistGraphCreate, Operation::Regular,
+        mpi_dist_graph_create, MPI_DIST_GRAPH_CREATE,
+        comm_t, int_ptr_t, int_ptr_t, int_ptr_t, int_ptr_t, int_ptr_t, info_t,
+        int_ptr_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC11(
+        Operation::DistGraphCreateAdjacent, Operation::Regular,
+        mpi_dist_graph_create_adjacent, MPI_DIST_GRAPH_CREATE_ADJACENT,
+        comm_t, int_ptr_t, int_ptr_t, int_ptr_t, int_ptr_t, int_ptr_t,
+        int_ptr_t, info_t, int_ptr_t, comm_t, err_t
+);
+
+//! Creating communicators
+DEFINE_FORTRAN_FUNC3(
+        Operation::CommDup, Operation::Regular,
+        mpi_comm_dup, MPI_COMM_DUP,
+        comm_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC5(
+        Operation::CommSplit, Operation::Regular,
+        mpi_comm_split, MPI_COMM_SPLIT,
+        comm_t, int_ptr_t, int_ptr_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC6(
+        Operation::CommSplitType, Operation::Regular,
+        mpi_comm_split_type, MPI_COMM_SPLIT_TYPE,
+        comm_t, int_ptr_t, int_ptr_t, info_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::CommCreate, Operation::Regular,
+        mpi_comm_create, MPI_COMM_CREATE,
+        comm_t, group_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC5(
+        Operation::CommCreateGroup, Operation::Regular,
+        mpi_comm_create_group, MPI_COMM_CREATE_GROUP,
+        comm_t, group_t, tag_t, comm_t, err_t
+);
+DEFINE_FORTRAN_FUNC7(
+        Operation::IntercommCreate, Operation::Regular,
+        mpi_intercomm_create, MPI_INTERCOMM_CREATE,
+        comm_t, rank_t, comm_t, rank_t, tag_t, comm_t, err_t
+);
+
+
+//! The version MPI 4.0 introduces the non-blocking sendrecv primitives, the
+//! partitioned primitives, the persistent collectives and the large count
+//! flavors, which are only available in the mpi_f08 bindings
+#if MPI_VERSION >= 4
+
+//! Non-blocking sendrecv primitives
+DEFINE_FORTRAN_FUNC13(
+        Operation::Isendrecv, Operation::Regular,
+        mpi_isendrecv, MPI_ISENDRECV,
+        sendbuf_t, count_t, data_t, rank_t, tag_t, recvbuf_t, count_t, data_t,
+        rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::IsendrecvReplace, Operation::Regular,
+        mpi_isendrecv_replace, MPI_ISENDRECV_REPLACE,
+        recvbuf_t, count_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+        request_t, err_t
+);
+
+//! Partitioned primitives
+DEFINE_FORTRAN_FUNC4(
+        Operation::Parrived, Operation::Regular,
+        mpi_parrived, MPI_PARRIVED,
+        request_t, partition_t, flag_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::PrecvInit, Operation::Regular,
+        mpi_precv_init, MPI_PRECV_INIT,
+        recvbuf_t, partition_t, count_c_t, data_t, rank_t, tag_t, comm_t,
+        info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC3(
+        Operation::Pready, Operation::Regular,
+        mpi_pready, MPI_PREADY,
+        partition_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::PreadyList, Operation::Regular,
+        mpi_pready_list, MPI_PREADY_LIST,
+        count_t, partitions_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::PreadyRange, Operation::Regular,
+        mpi_pready_range, MPI_PREADY_RANGE,
+        partition_t, partition_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::PsendInit, Operation::Regular,
+        mpi_psend_init, MPI_PSEND_INIT,
+        sendbuf_t, partition_t, count_c_t, data_t, rank_t, tag_t, comm_t,
+        info_t, request_t, err_t
+);
+
+//! Persistent collectives
+DEFINE_FORTRAN_FUNC10(
+        Operation::AllgatherInit, Operation::Regular,
+        mpi_allgather_init, MPI_ALLGATHER_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FORTRAN_FUNC11(
+        Operation::AllgathervInit, Operation::Regular,
+        mpi_allgatherv_init, MPI_ALLGATHERV_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::AllreduceInit, Operation::Regular,
+        mpi_allreduce_init, MPI_ALLREDUCE_INIT,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t,
+        err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::AlltoallInit, Operation::Regular,
+        mpi_alltoall_init, MPI_ALLTOALL_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FORTRAN_FUNC12(
+        Operation::AlltoallvInit, Operation::Regular,
+        mpi_alltoallv_init, MPI_ALLTOALLV_INIT,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC12(
+        Operation::AlltoallwInit, Operation::Regular,
+        mpi_alltoallw_init, MPI_ALLTOALLW_INIT,
+        sendbuf_t, counts_t, displs_t, datas_t, recvbuf_t, counts_t, displs_t,
+        datas_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC4(
+        Operation::BarrierInit, Operation::Regular,
+        mpi_barrier_init, MPI_BARRIER_INIT,
+        comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC8(
+        Operation::BcastInit, Operation::Regular,
+        mpi_bcast_init, MPI_BCAST_INIT,
+        recvbuf_t, count_t, data_t, rank_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC11(
+        Operation::GatherInit, Operation::Regular,
+        mpi_gather_init, MPI_GATHER_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
+        info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC12(
+        Operation::GathervInit, Operation::Regular,
+        mpi_gatherv_init, MPI_GATHERV_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        rank_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::ReduceInit, Operation::Regular,
+        mpi_reduce_init, MPI_REDUCE_INIT,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, rank_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::ReduceScatterInit, Operation::Regular,
+        mpi_reduce_scatter_init, MPI_REDUCE_SCATTER_INIT,
+        sendbuf_t, recvbuf_t, counts_t, data_t, op_t, comm_t, info_t, request_t,
+        err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::ReduceScatterBlockInit, Operation::Regular,
+        mpi_reduce_scatter_block_init, MPI_REDUCE_SCATTER_BLOCK_INIT,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t,
+        err_t
+);
+DEFINE_FORTRAN_FUNC11(
+        Operation::ScatterInit, Operation::Regular,
+        mpi_scatter_init, MPI_SCATTER_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, rank_t, comm_t,
+        info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC12(
+        Operation::ScattervInit, Operation::Regular,
+        mpi_scatterv_init, MPI_SCATTERV_INIT,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, count_t, data_t,
+        rank_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::ScanInit, Operation::Regular,
+        mpi_scan_init, MPI_SCAN_INIT,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t,
+        err_t
+);
+DEFINE_FORTRAN_FUNC9(
+        Operation::ExscanInit, Operation::Regular,
+        mpi_exscan_init, MPI_EXSCAN_INIT,
+        sendbuf_t, recvbuf_t, count_t, data_t, op_t, comm_t, info_t, request_t,
+        err_t
+);
+
+//! Persistent neighborhood collectives
+DEFINE_FORTRAN_FUNC10(
+        Operation::NeighborAllgatherInit, Operation::Regular,
+        mpi_neighbor_allgather_init, MPI_NEIGHBOR_ALLGATHER_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FORTRAN_FUNC11(
+        Operation::NeighborAllgathervInit, Operation::Regular,
+        mpi_neighbor_allgatherv_init, MPI_NEIGHBOR_ALLGATHERV_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, counts_t, displs_t, data_t,
+        comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC10(
+        Operation::NeighborAlltoallInit, Operation::Regular,
+        mpi_neighbor_alltoall_init, MPI_NEIGHBOR_ALLTOALL_INIT,
+        sendbuf_t, count_t, data_t, recvbuf_t, count_t, data_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FORTRAN_FUNC12(
+        Operation::NeighborAlltoallvInit, Operation::Regular,
+        mpi_neighbor_alltoallv_init, MPI_NEIGHBOR_ALLTOALLV_INIT,
+        sendbuf_t, counts_t, displs_t, data_t, recvbuf_t, counts_t, displs_t,
+        data_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FORTRAN_FUNC12(
+        Operation::NeighborAlltoallwInit, Operation::Regular,
+        mpi_neighbor_alltoallw_init, MPI_NEIGHBOR_ALLTOALLW_INIT,
+        sendbuf_t, counts_t, aint_t, datas_t, recvbuf_t, counts_t, aint_t,
+        datas_t, comm_t, info_t, request_t, err_t
+);
+
+//! The large count flavors only have mpi_f08 bindings, which take the
+//! mpi_f08 statuses
+namespace f08 {
+
+//! Blocking large primitives of the mpi_f08 bindings
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Bsend, Operation::Large,
+        void, mpi_bsend_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::Mrecv, Operation::Large,
+        void, mpi_mrecv_c_f08_,
+        recvbuf_t, count_c_t, data_t, message_t, status_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Recv, Operation::Large,
+        void, mpi_recv_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, status_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Rsend, Operation::Large,
+        void, mpi_rsend_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Send, Operation::Large,
+        void, mpi_send_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, err_t
+);
+DEFINE_FUNC13(
+        Operation::Fortran, Operation::Sendrecv, Operation::Large,
+        void, mpi_sendrecv_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, recvbuf_t, count_c_t,
+        data_t, rank_t, tag_t, comm_t, status_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::SendrecvReplace, Operation::Large,
+        void, mpi_sendrecv_replace_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+        status_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Ssend, Operation::Large,
+        void, mpi_ssend_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, err_t
+);
+
+//! Persistent large primitives of the mpi_f08 bindings
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::BsendInit, Operation::Large,
+        void, mpi_bsend_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::RecvInit, Operation::Large,
+        void, mpi_recv_init_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::RsendInit, Operation::Large,
+        void, mpi_rsend_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::SendInit, Operation::Large,
+        void, mpi_send_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::SsendInit, Operation::Large,
+        void, mpi_ssend_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+
+//! Blocking large collectives of the mpi_f08 bindings
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Allgather, Operation::Large,
+        void, mpi_allgather_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Allgatherv, Operation::Large,
+        void, mpi_allgatherv_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Allreduce, Operation::Large,
+        void, mpi_allreduce_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Alltoall, Operation::Large,
+        void, mpi_alltoall_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Alltoallv, Operation::Large,
+        void, mpi_alltoallv_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Alltoallw, Operation::Large,
+        void, mpi_alltoallw_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::Bcast, Operation::Large,
+        void, mpi_bcast_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, comm_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Gather, Operation::Large,
+        void, mpi_gather_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Gatherv, Operation::Large,
+        void, mpi_gatherv_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        rank_t, comm_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Reduce, Operation::Large,
+        void, mpi_reduce_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, rank_t, comm_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::ReduceScatter, Operation::Large,
+        void, mpi_reduce_scatter_c_f08_,
+        sendbuf_t, recvbuf_t, counts_c_t, data_t, op_t, comm_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::ReduceScatterBlock, Operation::Large,
+        void, mpi_reduce_scatter_block_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Scatter, Operation::Large,
+        void, mpi_scatter_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Scatterv, Operation::Large,
+        void, mpi_scatterv_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, count_c_t, data_t,
+        rank_t, comm_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Scan, Operation::Large,
+        void, mpi_scan_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Exscan, Operation::Large,
+        void, mpi_exscan_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, err_t
+);
+
+//! Non-blocking large primitives of the mpi_f08 bindings
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Ibsend, Operation::Large,
+        void, mpi_ibsend_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::Imrecv, Operation::Large,
+        void, mpi_imrecv_c_f08_,
+        recvbuf_t, count_c_t, data_t, message_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Irecv, Operation::Large,
+        void, mpi_irecv_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Irsend, Operation::Large,
+        void, mpi_irsend_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Isend, Operation::Large,
+        void, mpi_isend_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC13(
+        Operation::Fortran, Operation::Isendrecv, Operation::Large,
+        void, mpi_isendrecv_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, recvbuf_t, count_c_t,
+        data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::IsendrecvReplace, Operation::Large,
+        void, mpi_isendrecv_replace_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, tag_t, rank_t, tag_t, comm_t,
+        request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Issend, Operation::Large,
+        void, mpi_issend_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, tag_t, comm_t, request_t, err_t
+);
+
+//! Non-blocking large collectives of the mpi_f08 bindings
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Iallgather, Operation::Large,
+        void, mpi_iallgather_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Iallgatherv, Operation::Large,
+        void, mpi_iallgatherv_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Iallreduce, Operation::Large,
+        void, mpi_iallreduce_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Ialltoall, Operation::Large,
+        void, mpi_ialltoall_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::Ialltoallv, Operation::Large,
+        void, mpi_ialltoallv_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::Ialltoallw, Operation::Large,
+        void, mpi_ialltoallw_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::Ibcast, Operation::Large,
+        void, mpi_ibcast_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Igather, Operation::Large,
+        void, mpi_igather_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::Igatherv, Operation::Large,
+        void, mpi_igatherv_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        rank_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Ireduce, Operation::Large,
+        void, mpi_ireduce_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, rank_t, comm_t,
+        request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::IreduceScatter, Operation::Large,
+        void, mpi_ireduce_scatter_c_f08_,
+        sendbuf_t, recvbuf_t, counts_c_t, data_t, op_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::IreduceScatterBlock, Operation::Large,
+        void, mpi_ireduce_scatter_block_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Iscatter, Operation::Large,
+        void, mpi_iscatter_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::Iscatterv, Operation::Large,
+        void, mpi_iscatterv_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, count_c_t, data_t,
+        rank_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Iscan, Operation::Large,
+        void, mpi_iscan_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::Iexscan, Operation::Large,
+        void, mpi_iexscan_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, request_t, err_t
+);
+
+//! Persistent large collectives of the mpi_f08 bindings
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::AllgatherInit, Operation::Large,
+        void, mpi_allgather_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::AllgathervInit, Operation::Large,
+        void, mpi_allgatherv_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::AllreduceInit, Operation::Large,
+        void, mpi_allreduce_init_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::AlltoallInit, Operation::Large,
+        void, mpi_alltoall_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t, err_t
+);
+DEFINE_FUNC12(
+        Operation::Fortran, Operation::AlltoallvInit, Operation::Large,
+        void, mpi_alltoallv_init_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC12(
+        Operation::Fortran, Operation::AlltoallwInit, Operation::Large,
+        void, mpi_alltoallw_init_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::BcastInit, Operation::Large,
+        void, mpi_bcast_init_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::GatherInit, Operation::Large,
+        void, mpi_gather_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC12(
+        Operation::Fortran, Operation::GathervInit, Operation::Large,
+        void, mpi_gatherv_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        rank_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::ReduceInit, Operation::Large,
+        void, mpi_reduce_init_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, rank_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::ReduceScatterInit, Operation::Large,
+        void, mpi_reduce_scatter_init_c_f08_,
+        sendbuf_t, recvbuf_t, counts_c_t, data_t, op_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::ReduceScatterBlockInit, Operation::Large,
+        void, mpi_reduce_scatter_block_init_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::ScatterInit, Operation::Large,
+        void, mpi_scatter_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC12(
+        Operation::Fortran, Operation::ScattervInit, Operation::Large,
+        void, mpi_scatterv_init_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, count_c_t, data_t,
+        rank_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::ScanInit, Operation::Large,
+        void, mpi_scan_init_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t,
+        request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::ExscanInit, Operation::Large,
+        void, mpi_exscan_init_c_f08_,
+        sendbuf_t, recvbuf_t, count_c_t, data_t, op_t, comm_t, info_t,
+        request_t, err_t
+);
+
+//! Creating large RMA windows of the mpi_f08 bindings
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::WinAllocate, Operation::Large,
+        void, mpi_win_allocate_c_f08_,
+        aint_t, aint_t, info_t, comm_t, baseptr_t, win_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::WinAllocateShared, Operation::Large,
+        void, mpi_win_allocate_shared_c_f08_,
+        aint_t, aint_t, info_t, comm_t, baseptr_t, win_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::WinCreate, Operation::Large,
+        void, mpi_win_create_c_f08_,
+        recvbuf_t, aint_t, aint_t, info_t, comm_t, win_t, err_t
+);
+
+//! Large RMA communication of the mpi_f08 bindings
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Accumulate, Operation::Large,
+        void, mpi_accumulate_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t, op_t,
+        win_handle_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Get, Operation::Large,
+        void, mpi_get_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t, err_t
+);
+DEFINE_FUNC13(
+        Operation::Fortran, Operation::GetAccumulate, Operation::Large,
+        void, mpi_get_accumulate_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        aint_t, count_c_t, data_t, op_t, win_handle_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::Put, Operation::Large,
+        void, mpi_put_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t, err_t
+);
+
+//! Request-based large RMA communication of the mpi_f08 bindings
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::Raccumulate, Operation::Large,
+        void, mpi_raccumulate_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t, op_t,
+        win_handle_t, request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Rget, Operation::Large,
+        void, mpi_rget_c_f08_,
+        recvbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t, request_t, err_t
+);
+DEFINE_FUNC14(
+        Operation::Fortran, Operation::RgetAccumulate, Operation::Large,
+        void, mpi_rget_accumulate_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, rank_t,
+        aint_t, count_c_t, data_t, op_t, win_handle_t, request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::Rput, Operation::Large,
+        void, mpi_rput_c_f08_,
+        sendbuf_t, count_c_t, data_t, rank_t, aint_t, count_c_t, data_t,
+        win_handle_t, request_t, err_t
+);
+
+
+//! Independent large file accesses of the mpi_f08 bindings
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileRead, Operation::Large,
+        void, mpi_file_read_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileReadAt, Operation::Large,
+        void, mpi_file_read_at_c_f08_,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileReadShared, Operation::Large,
+        void, mpi_file_read_shared_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileWrite, Operation::Large,
+        void, mpi_file_write_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileWriteAt, Operation::Large,
+        void, mpi_file_write_at_c_f08_,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileWriteShared, Operation::Large,
+        void, mpi_file_write_shared_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t, err_t
+);
+
+//! Collective large file accesses of the mpi_f08 bindings
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileReadAll, Operation::Large,
+        void, mpi_file_read_all_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileReadAtAll, Operation::Large,
+        void, mpi_file_read_at_all_c_f08_,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileReadOrdered, Operation::Large,
+        void, mpi_file_read_ordered_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileWriteAll, Operation::Large,
+        void, mpi_file_write_all_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileWriteAtAll, Operation::Large,
+        void, mpi_file_write_at_all_c_f08_,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, status_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileWriteOrdered, Operation::Large,
+        void, mpi_file_write_ordered_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, status_t, err_t
+);
+
+//! Non-blocking large file accesses of the mpi_f08 bindings
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileIread, Operation::Large,
+        void, mpi_file_iread_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileIreadAt, Operation::Large,
+        void, mpi_file_iread_at_c_f08_,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileIreadShared, Operation::Large,
+        void, mpi_file_iread_shared_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileIwrite, Operation::Large,
+        void, mpi_file_iwrite_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileIwriteAt, Operation::Large,
+        void, mpi_file_iwrite_at_c_f08_,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileIwriteShared, Operation::Large,
+        void, mpi_file_iwrite_shared_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, request_t, err_t
+);
+
+//! Non-blocking large collective file accesses of the mpi_f08 bindings
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileIreadAll, Operation::Large,
+        void, mpi_file_iread_all_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileIreadAtAll, Operation::Large,
+        void, mpi_file_iread_at_all_c_f08_,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileIwriteAll, Operation::Large,
+        void, mpi_file_iwrite_all_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, request_t, err_t
+);
+DEFINE_FUNC7(
+        Operation::Fortran, Operation::FileIwriteAtAll, Operation::Large,
+        void, mpi_file_iwrite_at_all_c_f08_,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, request_t, err_t
+);
+
+//! Split collective large file accesses of the mpi_f08 bindings
+DEFINE_FUNC5(
+        Operation::Fortran, Operation::FileReadAllBegin, Operation::Large,
+        void, mpi_file_read_all_begin_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileReadAtAllBegin, Operation::Large,
+        void, mpi_file_read_at_all_begin_c_f08_,
+        file_handle_t, offset_t, recvbuf_t, count_c_t, data_t, err_t
+);
+DEFINE_FUNC5(
+        Operation::Fortran, Operation::FileReadOrderedBegin, Operation::Large,
+        void, mpi_file_read_ordered_begin_c_f08_,
+        file_handle_t, recvbuf_t, count_c_t, data_t, err_t
+);
+DEFINE_FUNC5(
+        Operation::Fortran, Operation::FileWriteAllBegin, Operation::Large,
+        void, mpi_file_write_all_begin_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, err_t
+);
+DEFINE_FUNC6(
+        Operation::Fortran, Operation::FileWriteAtAllBegin, Operation::Large,
+        void, mpi_file_write_at_all_begin_c_f08_,
+        file_handle_t, offset_t, sendbuf_t, count_c_t, data_t, err_t
+);
+DEFINE_FUNC5(
+        Operation::Fortran, Operation::FileWriteOrderedBegin, Operation::Large,
+        void, mpi_file_write_ordered_begin_c_f08_,
+        file_handle_t, sendbuf_t, count_c_t, data_t, err_t
+);
+
+//! Blocking large neighborhood collectives of the mpi_f08 bindings
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::NeighborAllgather, Operation::Large,
+        void, mpi_neighbor_allgather_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::NeighborAllgatherv, Operation::Large,
+        void, mpi_neighbor_allgatherv_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, err_t
+);
+DEFINE_FUNC8(
+        Operation::Fortran, Operation::NeighborAlltoall, Operation::Large,
+        void, mpi_neighbor_alltoall_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::NeighborAlltoallv, Operation::Large,
+        void, mpi_neighbor_alltoallv_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::NeighborAlltoallw, Operation::Large,
+        void, mpi_neighbor_alltoallw_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, err_t
+);
+
+//! Non-blocking large neighborhood collectives of the mpi_f08 bindings
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::IneighborAllgather, Operation::Large,
+        void, mpi_ineighbor_allgather_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::IneighborAllgatherv, Operation::Large,
+        void, mpi_ineighbor_allgatherv_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, request_t, err_t
+);
+DEFINE_FUNC9(
+        Operation::Fortran, Operation::IneighborAlltoall, Operation::Large,
+        void, mpi_ineighbor_alltoall_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::IneighborAlltoallv, Operation::Large,
+        void, mpi_ineighbor_alltoallv_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::IneighborAlltoallw, Operation::Large,
+        void, mpi_ineighbor_alltoallw_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, request_t, err_t
+);
+
+//! Persistent large neighborhood collectives of the mpi_f08 bindings
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::NeighborAllgatherInit, Operation::Large,
+        void, mpi_neighbor_allgather_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t, err_t
+);
+DEFINE_FUNC11(
+        Operation::Fortran, Operation::NeighborAllgathervInit, Operation::Large,
+        void, mpi_neighbor_allgatherv_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, counts_c_t, displs_c_t, data_t,
+        comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC10(
+        Operation::Fortran, Operation::NeighborAlltoallInit, Operation::Large,
+        void, mpi_neighbor_alltoall_init_c_f08_,
+        sendbuf_t, count_c_t, data_t, recvbuf_t, count_c_t, data_t, comm_t,
+        info_t, request_t, err_t
+);
+DEFINE_FUNC12(
+        Operation::Fortran, Operation::NeighborAlltoallvInit, Operation::Large,
+        void, mpi_neighbor_alltoallv_init_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, data_t, recvbuf_t, counts_c_t,
+        displs_c_t, data_t, comm_t, info_t, request_t, err_t
+);
+DEFINE_FUNC12(
+        Operation::Fortran, Operation::NeighborAlltoallwInit, Operation::Large,
+        void, mpi_neighbor_alltoallw_init_c_f08_,
+        sendbuf_t, counts_c_t, displs_c_t, datas_t, recvbuf_t, counts_c_t,
+        displs_c_t, datas_t, comm_t, info_t, request_t, err_t
+);
+
+} // namespace f08
 
 #endif
 